@@ -0,0 +1,107 @@
+/**
+ * @brief Defines an arena of memory (arena)
+ *
+ * @file arena.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include "types.h"
+
+typedef struct _Arena Arena;
+
+/**
+ * @brief Creates an arena
+ *
+ * arena_create() creates an arena, which hands out memory from large chunks and
+ * releases all of it at once.
+ * @return pointer to the arena created, NULL otherwise
+ */
+Arena* arena_create();
+
+/**
+ * @brief Creates an arena with chunks of a given size
+ *
+ * arena_create_size(size_t chunk_size) creates an arena like arena_create(), but
+ * taking chunks of chunk_size bytes, so an arena holding a few strings does not
+ * cost a large chunk.
+ * @param chunk_size bytes of every chunk.
+ * @return pointer to the arena created, NULL otherwise
+ */
+Arena* arena_create_size(size_t chunk_size);
+
+/**
+ * @brief Destroyes an arena
+ *
+ * arena_destroy(Arena* arena) destroyes the arena and all the memory given by it.
+ * @param arena pointer to the arena we want to destroy.
+ */
+void arena_destroy(Arena* arena);
+
+/**
+ * @brief Empties an arena
+ *
+ * arena_reset(Arena* arena) releases all the memory given by the arena at once,
+ * keeping its chunks to be used again.
+ * @param arena pointer to the arena.
+ */
+void arena_reset(Arena* arena);
+
+/**
+ * @brief Allocates memory
+ *
+ * arena_alloc(Arena* arena, size_t size) gives memory suitably aligned for any type.
+ * If arena is NULL the memory comes from malloc().
+ * @param arena pointer to the arena, or NULL.
+ * @param size number of bytes.
+ * @return pointer to the memory, NULL if ERROR.
+ */
+void* arena_alloc(Arena* arena, size_t size);
+
+/**
+ * @brief Copies a string
+ *
+ * arena_strdup(Arena* arena, const char* str) copies the string to memory of the arena.
+ * If arena is NULL the memory comes from malloc().
+ * @param arena pointer to the arena, or NULL.
+ * @param str string to copy.
+ * @return the copy, NULL if ERROR.
+ */
+char* arena_strdup(Arena* arena, const char* str);
+
+/**
+ * @brief Frees memory
+ *
+ * arena_free(Arena* arena, void* ptr) frees memory given by arena_alloc(). It does
+ * nothing unless arena is NULL, as an arena releases its memory all at once.
+ * @param arena pointer to the arena the memory came from, or NULL.
+ * @param ptr pointer to the memory.
+ */
+void arena_free(Arena* arena, void* ptr);
+
+/**
+ * @brief Gets the number of chunks
+ *
+ * arena_get_number_of_chunks(Arena* arena) returns how many chunks the arena has
+ * asked malloc() for.
+ * @param arena pointer to the arena.
+ * @return number of chunks, -1 if ERROR.
+ */
+int arena_get_number_of_chunks(Arena* arena);
+
+/**
+ * @brief Gets the memory used
+ *
+ * arena_get_size(Arena* arena) returns the bytes given by the arena since it was
+ * created or emptied.
+ * @param arena pointer to the arena.
+ * @return number of bytes, -1 if ERROR.
+ */
+long arena_get_size(Arena* arena);
+
+#endif
@@ -0,0 +1,31 @@
+/**
+ * @brief It declares the tests for the arena module
+ *
+ * @file arena_test.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef ARENA_TEST_H
+#define ARENA_TEST_H
+
+#include "arena.h"
+#include "test.h"
+
+
+void test1_arena_create();
+void test1_arena_create_size();
+void test2_arena_create_size();
+void test1_arena_alloc();
+void test2_arena_alloc();
+void test3_arena_alloc();
+void test4_arena_alloc();
+void test1_arena_strdup();
+void test2_arena_strdup();
+void test1_arena_reset();
+void test2_arena_reset();
+
+
+#endif
@@ -44,4 +44,23 @@ typedef enum enum_Command {
  */
 T_Command command_get_user_input();
 
+/**
+ * @brief Gets the commands starting with what the user typed
+ * command_complete(const char* prefix, const char** words, int max) gets the names and
+ * abbreviations of the commands starting with the prefix, whatever the case, in
+ * alphabetical order
+ * @param prefix beginning of the command
+ * @param words where the first max names are written
+ * @param max room in words
+ * @return number of names starting with the prefix, -1 in case of error
+ */
+int command_complete(const char* prefix, const char** words, int max);
+
+/**
+ * @brief Frees the names of the commands
+ * command_free_words() frees the tree of names made by command_get_user_input(),
+ * it is made again if another command is read
+ */
+void command_free_words();
+
 #endif
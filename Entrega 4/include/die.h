@@ -10,6 +10,7 @@
 #ifndef DIE_H
 #define DIE_H
 #include "types.h"
+#include "arena.h"
 
 typedef struct _Die Die;
 
@@ -24,6 +25,18 @@ typedef struct _Die Die;
  */
 Die* die_create(Id id, int min, int max);
 
+/**
+ * @brief Creates a die in an arena
+ *
+ * die_create_in(Arena* arena, Id id, int min, int max) creates a die whose memory comes from the arena
+ * @param arena arena of the die, NULL to use malloc()
+ * @param id, identifier of the die
+ * @param min, minimun value of the die
+ * @param max, maximun value of the die
+ * @return pointer to the die created, NULL if error
+ */
+Die* die_create_in(Arena* arena, Id id, int min, int max);
+
 /**
  * @brief Destroys a die
  *
@@ -19,6 +19,7 @@
 #include "die.h"
 #include "link.h"
 
+#define IN_PLAYER -2   /*!< Location of the objects carried by the player */
 
 typedef struct _Game Game;
 
@@ -52,6 +53,24 @@ STATUS  game_update(Game* game, T_Command cmd);
  */
 STATUS  game_destroy(Game* game);
 
+/**
+ * @brief Empties a game
+ * game_reset(Game* game) destroys the spaces, objects, links and player of the game,
+ * releasing the memory of its world at once, and leaves it as if it had just been created
+ * @param game pointer to the game
+ * @return OK if the process is successful, ERROR in case of error
+ */
+STATUS game_reset(Game* game);
+
+/**
+ * @brief Gets the arena of a game
+ * game_get_arena(Game* game) returns the arena the world of the game is allocated in,
+ * which lives until the game is reset or destroyed
+ * @param game pointer to the game
+ * @return pointer to the arena, NULL if ERROR
+ */
+Arena* game_get_arena(Game* game);
+
 /**
  * @brief Indicates if the game is over or not
  * game_is_over(Game *game) indicates the game status
@@ -147,7 +166,8 @@ Object* game_get_object_by_index(Game* game, int index);
 
 /**
  * @brief Get the object that is involved in the game
- * game_get_object_by_name(Game* game) returns the object (object) from the game (game)
+ * game_get_object_by_name(Game* game) returns the object (object) from the game (game),
+ * or the only one whose name begins with the one given if none has that name
  * @param game pointer to the game from which we want to obtain the object
  * @param string of the name of the object
  * @return Pointer to the required object in a satisfactory case, NULL in an unfavorable case
@@ -158,23 +178,102 @@ Object* game_get_object_by_name(Game* game, char* name);
 
 /**
  * @brief Get the link with the provided name
- * game_get_link_by_name(Game* game) returns the link from the game (game)
+ * game_get_link_by_name(Game* game) returns the link from the game (game),
+ * or the only one whose name begins with the one given if none has that name
  * @param game pointer to the game from which we want to obtain the link
  * @param string of the name of the link
  * @return Pointer to the required object in a satisfactory case, NULL in an unfavorable case
  *
  */
 Link* game_get_link_by_name(Game* game, char* name);
+
+/**
+ * @brief Gets the names of objects and links beginning like the one given
+ *
+ * game_complete_name(Game* game, const char* prefix, const char** names, int max) gets
+ * the names of the objects beginning with the prefix in alphabetical order, followed by
+ * the names of the links, to complete what the user is typing
+ * @param game pointer to the game
+ * @param prefix beginning of the name
+ * @param names where the first max names are written
+ * @param max room in names
+ * @return number of names beginning with the prefix, -1 in case of error
+ */
+int game_complete_name(Game* game, const char* prefix, const char** names, int max);
+
+/**
+ * @brief Indexes the objects and links of a game by their name
+ *
+ * game_build_names(Game* game) makes the index game_get_object_by_name() and
+ * game_get_link_by_name() look in. It is made again by itself when objects or links
+ * are added, but not when the name of one that was already added changes, so it
+ * must be called after loading a game.
+ * @param game pointer to the game
+ * @return OK if the process is completed succesfully, ERROR otherwise
+ */
+STATUS game_build_names(Game* game);
+
+/**
+ * @brief Sets whether names are looked for whatever their case
+ *
+ * game_set_ignore_case(Game* game, BOOL ignore_case) makes game_get_object_by_name()
+ * and game_get_link_by_name() ignore the case of the names, or not. Names are compared
+ * with their case by default.
+ * @param game pointer to the game
+ * @param ignore_case TRUE to ignore the case of the names
+ * @return OK if the process is completed succesfully, ERROR otherwise
+ */
+STATUS game_set_ignore_case(Game* game, BOOL ignore_case);
 /**
  * @brief Get the location of an object that participates in the game
  * game_get_object_location(Game* game) returns the location of a game (game) object (object)
  * @param game pointer to the game from which we want to obtain the location of the object
  * @param id identifier of the object you want to obtain the location
- * @return Integer indicating the position in favorable case, or ERR in unfavorable case
+ * @return Identifier of the space the object is in, NO_ID if it is in no space
  *
  */
 Id  game_get_object_location(Game* game, Id id);
 
+/**
+ * @brief Moves an object of the game
+ *
+ * game_move_object(Game* game, Id id, Id location) takes the object out of the space or
+ * inventory it is in and puts it in another one. The game remembers where every object
+ * is, so objects must be placed with this function and not with space_set_object() or
+ * player_set_object().
+ * @param game pointer to the game
+ * @param id identifier of the object
+ * @param location identifier of a space, IN_PLAYER for the inventory of the player or NO_ID for nowhere
+ * @return OK if the process is completed succesfully, ERROR otherwise, and then the object stays where it was
+ */
+STATUS game_move_object(Game* game, Id id, Id location);
+
+/**
+ * @brief Finds the objects of a game by their flags
+ *
+ * game_find_objects(Game* game, int with, int without, Set* within, Set* found) looks
+ * for the objects that have every flag of with and none of without, for example
+ * game_find_objects(game, OBJECT_HIDDEN, 0, NULL, found) for every hidden object.
+ * @param game pointer to the game
+ * @param with flags the objects must have, joined with |
+ * @param without flags the objects must not have, joined with |
+ * @param within only the objects of this set are looked at, NULL for all of them
+ * @param found set the objects found are added to, NULL to only count them
+ * @return number of objects found, -1 if ERROR
+ */
+int game_find_objects(Game* game, int with, int without, Set* within, Set* found);
+
+/**
+ * @brief Tells if a space can be seen
+ *
+ * game_space_is_lit(Game* game, Id id) tells if a space is illuminated, or if an
+ * object giving light is in it or carried by the player in it.
+ * @param game pointer to the game
+ * @param id identifier of the space
+ * @return TRUE if there is light in the space, FALSE otherwise
+ */
+BOOL game_space_is_lit(Game* game, Id id);
+
 /**
  * @brief Get the number of objects of a game
  * game_get_number_of_objects(Game* game) returns the number of objects a game has
@@ -199,6 +298,37 @@ int game_get_number_of_spaces(Game* game);
  */
 int game_get_number_of_links(Game* game);
 
+/**
+ * @brief Get every space of a game
+ * game_get_spaces(Game* game, int* n) returns the spaces of the game at once, so they
+ * can be walked without a call for each one. The array belongs to the game and may
+ * move when a space is added
+ * @param game pointer to the game
+ * @param n where the number of spaces is written
+ * @return array of the spaces, NULL in case of error or if the game never had any
+ */
+Space** game_get_spaces(Game* game, int* n);
+
+/**
+ * @brief Get every object of a game
+ * game_get_objects(Game* game, int* n) returns the objects of the game at once. The
+ * array belongs to the game and may move when an object is added
+ * @param game pointer to the game
+ * @param n where the number of objects is written
+ * @return array of the objects, NULL in case of error or if the game never had any
+ */
+Object** game_get_objects(Game* game, int* n);
+
+/**
+ * @brief Get every link of a game
+ * game_get_links(Game* game, int* n) returns the links of the game at once. The
+ * array belongs to the game and may move when a link is added
+ * @param game pointer to the game
+ * @param n where the number of links is written
+ * @return array of the links, NULL in case of error or if the game never had any
+ */
+Link** game_get_links(Game* game, int* n);
+
 /**
  * @brief Get the status of a game
  * game_get_status(Game* game) returns the game (game) status (STATUS)
@@ -255,6 +385,87 @@ STATUS  game_set_space(Game* game, Space* space);
  */
 STATUS game_set_link(Game* game, Link* link);
 
+/**
+ * @brief Opens or closes a link of the game
+ * game_set_link_status(Game* game, Id id, LINKSTATUS status) sets the status of the link
+ * with the given identifier and changes the map version of the game
+ * @param game pointer to the game the link belongs to
+ * @param id identifier of the link
+ * @param status OPENED or CLOSED
+ * @return STATUS OK if the process is successful, ERROR in case of error
+ *
+ */
+STATUS game_set_link_status(Game* game, Id id, LINKSTATUS status);
+
+/**
+ * @brief Gets the map version of the game
+ * game_get_map_version(Game* game) returns a number that changes every time a space
+ * or a link is added, the links of a space are set or a link is opened or closed, and
+ * is never repeated between games
+ * @param game pointer to the game
+ * @return the map version, -1 if ERROR
+ *
+ */
+long game_get_map_version(Game* game);
+
+/**
+ * @brief Builds the graph of the spaces and links of a game
+ *
+ * game_build_graph(Game* game) compiles the neighbours of every space. It is built
+ * again by itself when spaces or links are added or the links of a space are set,
+ * but not when the spaces a link joins change, so it must be called after loading a game.
+ * @param game pointer to the game
+ * @return OK if the process is completed succesfully, ERROR otherwise
+ */
+STATUS game_build_graph(Game* game);
+
+/**
+ * @brief Gets a neighbour of a space
+ *
+ * game_get_neighbour(Game* game, Id id, DIRECTION dir) gets the space reached through
+ * the link of a space in the given direction, whether the link is open or not.
+ * @param game pointer to the game
+ * @param id identifier of the space
+ * @param dir direction of the link
+ * @return identifier of the neighbour, NO_ID if there is none
+ */
+Id game_get_neighbour(Game* game, Id id, DIRECTION dir);
+
+/**
+ * @brief Gets the link of a space in a direction
+ *
+ * game_get_neighbour_link(Game* game, Id id, DIRECTION dir) gets the link of a space
+ * in the given direction.
+ * @param game pointer to the game
+ * @param id identifier of the space
+ * @param dir direction of the link
+ * @return identifier of the link, NO_ID if there is none
+ */
+Id game_get_neighbour_link(Game* game, Id id, DIRECTION dir);
+
+/**
+ * @brief Gets the status of the link of a space in a direction
+ *
+ * game_get_neighbour_status(Game* game, Id id, DIRECTION dir) gets the status of the
+ * link of a space in the given direction.
+ * @param game pointer to the game
+ * @param id identifier of the space
+ * @param dir direction of the link
+ * @return status of the link, CLOSED if there is none
+ */
+LINKSTATUS game_get_neighbour_status(Game* game, Id id, DIRECTION dir);
+
+/**
+ * @brief Gets the description version of the game
+ * game_get_descript_version(Game* game) returns a number that changes every time a command
+ * may have changed the objects of the player or the spaces, the die or the inspected text,
+ * and is never repeated between games
+ * @param game pointer to the game
+ * @return the description version, -1 if ERROR
+ *
+ */
+long game_get_descript_version(Game* game);
+
 
 /**
  * @brief Sets the status of a game
@@ -305,7 +516,7 @@ const char* game_get_rules_string(Game *game);
  * or if that object is being carried by the player
  * @param game pointer to the game
  * @param id identifier of the object we want to know the info
- * @return -2 if the player carries the object,-1 if error or identifier of the space the object is
+ * @return IN_PLAYER if the player carries the object, NO_ID if error or identifier of the space the object is
  *
  */
 Id game_object_location_management(Game* game, Id id);
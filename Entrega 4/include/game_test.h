@@ -19,6 +19,9 @@ void test2_game_create();
 
 void test1_game_update();
 void test2_game_update();
+void test3_game_update();
+void test4_game_update();
+void test5_game_update();
 
 void test1_game_get_space();
 void test2_game_get_space();
@@ -58,6 +61,27 @@ void test3_game_set_object();
 void test1_game_set_space();
 void test2_game_set_space();
 void test3_game_set_space();
+void test4_game_set_space();
+void test4_game_set_object();
+
+void test1_game_space_is_lit();
+void test1_game_find_objects();
+
+void test1_game_move_object();
+void test2_game_move_object();
+void test3_game_move_object();
+
+void test1_game_get_object_by_name();
+void test1_game_get_link_by_name();
+void test1_game_set_ignore_case();
+
+void test1_game_get_spaces();
+void test1_game_get_objects();
+void test1_game_get_links();
+
+void test2_game_get_object_by_name();
+void test2_game_get_link_by_name();
+void test1_game_complete_name();
 
 void test1_game_set_link();
 void test2_game_set_link();
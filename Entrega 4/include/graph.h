@@ -0,0 +1,125 @@
+/**
+ * @brief Defines the graph of spaces and links of a game (graph)
+ *
+ * @file graph.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include "types.h"
+#include "space.h"
+#include "link.h"
+
+typedef struct _Graph Graph;
+
+/**
+ * @brief Creates a graph
+ *
+ * graph_create() creates an empty graph.
+ * @return pointer to the graph created, NULL otherwise
+ */
+Graph* graph_create();
+
+/**
+ * @brief Destroyes a graph
+ *
+ * graph_destroy(Graph* graph) destroyes the graph, giving back to its links the
+ * slots of their status, so they must still exist.
+ * @param graph pointer to the graph we want to destroy.
+ */
+void graph_destroy(Graph* graph);
+
+/**
+ * @brief Builds a graph
+ *
+ * graph_build(Graph* graph, Space** spaces, int n_spaces, Link** links, int n_links)
+ * compiles the links of every space to its neighbours into rows of edges, one row
+ * per space. The status of each link is moved to a slot of the graph, so changing it
+ * with link_set_status() changes the graph too. If the spaces or the links change
+ * the graph must be built again.
+ * @param graph pointer to the graph.
+ * @param spaces spaces of the game.
+ * @param n_spaces number of spaces.
+ * @param links links of the game.
+ * @param n_links number of links.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS graph_build(Graph* graph, Space** spaces, int n_spaces, Link** links, int n_links);
+
+/**
+ * @brief Gets a neighbour of a space
+ *
+ * graph_get_neighbour(Graph* graph, Id id, DIRECTION dir) gets the space the link
+ * of a space in the given direction goes to, whether it is open or not.
+ * @param graph pointer to the graph.
+ * @param id identifier of the space.
+ * @param dir direction of the link.
+ * @return identifier of the neighbour, NO_ID if there is none.
+ */
+Id graph_get_neighbour(Graph* graph, Id id, DIRECTION dir);
+
+/**
+ * @brief Gets the link of a space in a direction
+ *
+ * graph_get_link(Graph* graph, Id id, DIRECTION dir) gets the link of a space in the
+ * given direction.
+ * @param graph pointer to the graph.
+ * @param id identifier of the space.
+ * @param dir direction of the link.
+ * @return identifier of the link, NO_ID if there is none.
+ */
+Id graph_get_link(Graph* graph, Id id, DIRECTION dir);
+
+/**
+ * @brief Gets the status of the link of a space in a direction
+ *
+ * graph_get_link_status(Graph* graph, Id id, DIRECTION dir) gets the status of the
+ * link of a space in the given direction.
+ * @param graph pointer to the graph.
+ * @param id identifier of the space.
+ * @param dir direction of the link.
+ * @return status of the link, CLOSED if there is none.
+ */
+LINKSTATUS graph_get_link_status(Graph* graph, Id id, DIRECTION dir);
+
+/**
+ * @brief Gets the neighbour a space can be left to
+ *
+ * graph_get_open_neighbour(Graph* graph, Id id, DIRECTION dir) gets the space the link
+ * of a space in the given direction goes to, only if the link is opened, reading the
+ * edge once.
+ * @param graph pointer to the graph.
+ * @param id identifier of the space.
+ * @param dir direction of the link.
+ * @return identifier of the neighbour, NO_ID if there is none or the link is closed.
+ */
+Id graph_get_open_neighbour(Graph* graph, Id id, DIRECTION dir);
+
+/**
+ * @brief Gets the number of edges of a space
+ *
+ * graph_get_number_of_edges(Graph* graph, Id id) gets how many links the space has.
+ * @param graph pointer to the graph.
+ * @param id identifier of the space.
+ * @return number of edges, -1 if the space is not in the graph or ERROR.
+ */
+int graph_get_number_of_edges(Graph* graph, Id id);
+
+/**
+ * @brief Gets an edge of a space
+ *
+ * graph_get_edge(Graph* graph, Id id, int index, DIRECTION* dir) gets the neighbour
+ * reached through one of the edges of a space, for walking the graph.
+ * @param graph pointer to the graph.
+ * @param id identifier of the space.
+ * @param index number of the edge, from 0 to graph_get_number_of_edges() - 1.
+ * @param dir where the direction of the edge is written, it may be NULL.
+ * @return identifier of the neighbour, NO_ID if there is none or ERROR.
+ */
+Id graph_get_edge(Graph* graph, Id id, int index, DIRECTION* dir);
+
+#endif
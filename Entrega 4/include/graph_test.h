@@ -0,0 +1,32 @@
+/**
+ * @brief It declares the tests for the graph module
+ *
+ * @file graph_test.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef GRAPH_TEST_H
+#define GRAPH_TEST_H
+
+#include "graph.h"
+#include "test.h"
+
+
+void test1_graph_create();
+void test1_graph_build();
+void test2_graph_build();
+void test1_graph_get_neighbour();
+void test2_graph_get_neighbour();
+void test1_graph_get_link();
+void test1_graph_get_link_status();
+void test2_graph_get_link_status();
+void test1_graph_get_number_of_edges();
+void test1_graph_get_edge();
+void test1_graph_destroy();
+void test1_graph_get_open_neighbour();
+
+
+#endif
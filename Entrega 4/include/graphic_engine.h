@@ -16,6 +16,15 @@
 
 typedef struct _Graphic_engine Graphic_engine;
 
+/**
+ * @brief Backends a graphic engine can paint the game with
+ */
+typedef enum {
+  TERMINAL_RENDER,   /*!< ANSI frames on the terminal */
+  NULL_RENDER,       /*!< Nothing is composed nor painted */
+  SNAPSHOT_RENDER    /*!< Plain text frames on a file */
+} RENDER;
+
 /**
  * @brief Crea un motor grafico
  *
@@ -24,6 +33,17 @@ typedef struct _Graphic_engine Graphic_engine;
  */
 Graphic_engine* graphic_engine_create();
 
+/**
+ * @brief Crea un motor grafico con el backend dado
+ *
+ * graphic_engine_create_render(RENDER render, const char *file) crea un motor grafico que pinta
+ * el juego con el backend (render) dado. graphic_engine_create() usa TERMINAL_RENDER.
+ * @param render, backend con el que se pinta el juego.
+ * @param file, fichero donde se escriben los frames con SNAPSHOT_RENDER, se ignora con el resto.
+ * @return puntero al nuevo motor grafico creado, NULL si hay error.
+ */
+Graphic_engine* graphic_engine_create_render(RENDER render, const char *file);
+
 /**
  * @brief Libera la memoria del motor grafico
  * graphic_engine_destroy(Graphic_engine *ge) Destruye el motor grafico (ge) dado
@@ -0,0 +1,88 @@
+/**
+ * @brief Defines a table from identifiers to positions (id_table)
+ *
+ * @file id_table.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#ifndef ID_TABLE_H
+#define ID_TABLE_H
+
+#include "types.h"
+
+#define NO_ENTRY -1   /*!< Position of an identifier not in a table */
+
+typedef struct _Id_table Id_table;
+
+/**
+ * @brief Creates a table of identifiers
+ *
+ * id_table_create() creates an empty table. While the identifiers are close to each
+ * other they are looked for in an array indexed by the identifier itself, and in a
+ * hash table when they are spread.
+ * @return pointer to the table created, NULL otherwise
+ */
+Id_table* id_table_create();
+
+/**
+ * @brief Destroyes a table of identifiers
+ *
+ * id_table_destroy(Id_table* table) destroyes the table.
+ * @param table pointer to the table we want to destroy.
+ */
+void id_table_destroy(Id_table* table);
+
+/**
+ * @brief Empties a table of identifiers
+ *
+ * id_table_clear(Id_table* table) removes every identifier, keeping the memory for the next ones.
+ * @param table pointer to the table.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS id_table_clear(Id_table* table);
+
+/**
+ * @brief Adds an identifier
+ *
+ * id_table_add(Id_table* table, Id id, int position) adds the position of an identifier,
+ * usually where its entity is in a list. If the identifier is already there the
+ * first position added is kept.
+ * @param table pointer to the table.
+ * @param id identifier.
+ * @param position position of the identifier, not negative.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS id_table_add(Id_table* table, Id id, int position);
+
+/**
+ * @brief Finds the position of an identifier
+ *
+ * id_table_find(Id_table* table, Id id) gets the first position added for the identifier.
+ * @param table pointer to the table.
+ * @param id identifier to look for.
+ * @return position of the identifier, NO_ENTRY if it is not in the table or ERROR.
+ */
+int id_table_find(Id_table* table, Id id);
+
+/**
+ * @brief Tells how a table looks for its identifiers
+ *
+ * id_table_is_direct(Id_table* table) tells whether the identifiers are looked for
+ * in an array indexed by the identifier or in a hash table.
+ * @param table pointer to the table.
+ * @return TRUE if they are looked for in an array, FALSE if in a hash table or ERROR.
+ */
+BOOL id_table_is_direct(Id_table* table);
+
+/**
+ * @brief Gets the number of identifiers
+ *
+ * id_table_get_number_of_ids(Id_table* table) returns how many different identifiers the table has.
+ * @param table pointer to the table.
+ * @return number of identifiers, -1 if ERROR.
+ */
+int id_table_get_number_of_ids(Id_table* table);
+
+#endif
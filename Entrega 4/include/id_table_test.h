@@ -0,0 +1,32 @@
+/**
+ * @brief It declares the tests for the id_table module
+ *
+ * @file id_table_test.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef ID_TABLE_TEST_H
+#define ID_TABLE_TEST_H
+
+#include "id_table.h"
+#include "test.h"
+
+
+void test1_id_table_create();
+void test1_id_table_add();
+void test2_id_table_add();
+void test3_id_table_add();
+void test1_id_table_find();
+void test2_id_table_find();
+void test3_id_table_find();
+void test4_id_table_find();
+void test5_id_table_find();
+void test1_id_table_is_direct();
+void test2_id_table_is_direct();
+void test1_id_table_clear();
+
+
+#endif
@@ -0,0 +1,89 @@
+/**
+ * @brief Defines a table of interned strings (intern)
+ *
+ * @file intern.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#ifndef INTERN_H
+#define INTERN_H
+
+#include "types.h"
+#include "arena.h"
+
+#define NO_STRING -1   /*!< Handle of the empty string */
+
+typedef struct _Intern Intern;
+
+/**
+ * @brief Creates a table of strings
+ *
+ * intern_create(Arena* arena) creates an empty table of strings. Every string is
+ * kept once, with its exact length, however many times it is used, so two handles
+ * of the same table are equal only if their strings are.
+ * @param arena arena the strings are copied to, NULL for one of the table's own.
+ * @return pointer to the table created, NULL otherwise
+ */
+Intern* intern_create(Arena* arena);
+
+/**
+ * @brief Destroyes a table of strings
+ *
+ * intern_destroy(Intern* intern) destroyes the table and every string in it.
+ * @param intern pointer to the table we want to destroy.
+ */
+void intern_destroy(Intern* intern);
+
+/**
+ * @brief Stores a string
+ *
+ * intern_put(Intern* intern, const char* str) returns the handle of the string,
+ * storing it first if it was not in the table yet.
+ * @param intern pointer to the table.
+ * @param str string to store.
+ * @return handle of the string, NO_STRING for the empty string or if ERROR.
+ */
+int intern_put(Intern* intern, const char* str);
+
+/**
+ * @brief Looks for a string
+ *
+ * intern_find(Intern* intern, const char* str) returns the handle of the string
+ * without storing it.
+ * @param intern pointer to the table.
+ * @param str string to look for.
+ * @return handle of the string, NO_STRING if it is empty or not in the table.
+ */
+int intern_find(Intern* intern, const char* str);
+
+/**
+ * @brief Gets a string
+ *
+ * intern_get(Intern* intern, int handle) returns the string stored with the given handle.
+ * @param intern pointer to the table.
+ * @param handle handle returned by intern_put().
+ * @return the string, "" for NO_STRING, NULL if ERROR.
+ */
+const char* intern_get(Intern* intern, int handle);
+
+/**
+ * @brief Gets the number of strings
+ *
+ * intern_get_number_of_strings(Intern* intern) returns how many different strings are stored.
+ * @param intern pointer to the table.
+ * @return number of strings, -1 if ERROR.
+ */
+int intern_get_number_of_strings(Intern* intern);
+
+/**
+ * @brief Gets the size of the strings
+ *
+ * intern_get_size(Intern* intern) returns the bytes taken by the strings stored.
+ * @param intern pointer to the table.
+ * @return number of bytes, -1 if ERROR.
+ */
+long intern_get_size(Intern* intern);
+
+#endif
@@ -0,0 +1,31 @@
+/**
+ * @brief It declares the tests for the intern module
+ *
+ * @file intern_test.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef INTERN_TEST_H
+#define INTERN_TEST_H
+
+#include "intern.h"
+#include "test.h"
+
+
+void test1_intern_create();
+void test1_intern_put();
+void test2_intern_put();
+void test3_intern_put();
+void test4_intern_put();
+void test1_intern_get();
+void test2_intern_get();
+void test3_intern_get();
+void test1_intern_get_size();
+void test1_intern_find();
+void test2_intern_find();
+
+
+#endif
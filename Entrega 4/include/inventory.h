@@ -10,7 +10,7 @@
 #ifndef INVENTORY_H
 #define INVENTORY_H
 #include "types.h"
-#include "set.h"
+#include "arena.h"
 
 typedef struct _Inventory Inventory;
 
@@ -22,6 +22,16 @@ typedef struct _Inventory Inventory;
  */
 Inventory* inventory_create(int maxobjects);
 
+/**
+ * @brief Creates an inventory in an arena
+ *
+ * inventory_create_in(Arena* arena, int maxobjects) creates an inventory whose memory comes from the arena
+ * @param arena arena of the inventory, NULL to use malloc()
+ * @param maxobjects max number of objects of the inventory
+ * @return pointer to the inventory created, NULL otherwise
+ */
+Inventory* inventory_create_in(Arena* arena, int maxobjects);
+
 /**
  * @brief Destroyes an inventory
  *
@@ -53,6 +63,18 @@ STATUS inventory_set_object(Inventory* inventory, Id id);
  */
 Id inventory_get_object(Inventory* inventory, int index);
 
+/**
+ * @brief Gets every object of the inventory at once
+ *
+ * inventory_get_objects(Inventory* inventory, int* n) gets the objects of the
+ * inventory, sorted by their identifier, without a call for each one. The array
+ * belongs to the inventory and changes when an object is set or removed.
+ * @param inventory pointer to the inventory.
+ * @param n where the number of objects is written.
+ * @return array of the identifiers of the objects, NULL if ERROR.
+ */
+const Id* inventory_get_objects(Inventory* inventory, int* n);
+
 
 /**
  * @brief Gets maximun number of objects of an inventory
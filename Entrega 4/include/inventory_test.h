@@ -22,6 +22,7 @@ void test2_inventory_create();
 void test1_inventory_set_object();
 void test2_inventory_set_object();
 void test3_inventory_set_object();
+void test4_inventory_set_object();
 
 void test1_inventory_get_object();
 void test2_inventory_get_object();
@@ -35,5 +36,8 @@ void test1_inventory_has_object();
 void test2_inventory_has_object();
 void test3_inventory_has_object();
 
+void test1_inventory_get_objects();
+void test2_inventory_get_objects();
+
 
 #endif
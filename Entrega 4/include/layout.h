@@ -0,0 +1,107 @@
+/**
+ * @brief Defines a line layout (layout)
+ *
+ * @file layout.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include "types.h"
+
+typedef struct _Layout Layout;
+
+/**
+ * @brief Creates a layout
+ *
+ * layout_create(int size) creates an empty line, measured in terminal columns.
+ * SGR sequences (\033[...m) and UTF-8 continuation bytes take no column.
+ * @param size bytes allocated at first, the line grows if needed.
+ * @return pointer to the layout created, NULL otherwise
+ */
+Layout* layout_create(int size);
+
+/**
+ * @brief Destroyes a layout
+ *
+ * layout_destroy(Layout* layout) destroyes the given layout.
+ * @param layout pointer to the layout we want to destroy.
+ */
+void layout_destroy(Layout* layout);
+
+/**
+ * @brief Empties a layout
+ *
+ * layout_clear(Layout* layout) empties the line so a new one can be composed.
+ * @param layout pointer to the layout we want to empty.
+ */
+void layout_clear(Layout* layout);
+
+/**
+ * @brief Appends a string
+ *
+ * layout_puts(Layout* layout, const char* str) appends str to the line.
+ * @param layout pointer to the layout.
+ * @param str string to append.
+ * @return OK if the string was appended, ERROR otherwise.
+ */
+STATUS layout_puts(Layout* layout, const char* str);
+
+/**
+ * @brief Pads the line up to a column
+ *
+ * layout_pad(Layout* layout, int column, char fill) appends fill until the line
+ * is column characters wide. Nothing is appended if it is already wider.
+ * @param layout pointer to the layout.
+ * @param column width the line must reach.
+ * @param fill character to pad with.
+ * @return OK if the line was padded, ERROR otherwise.
+ */
+STATUS layout_pad(Layout* layout, int column, char fill);
+
+/**
+ * @brief Appends a string in a fixed number of columns
+ *
+ * layout_fit(Layout* layout, const char* str, int width, BOOL right) appends str
+ * taking exactly width columns: shorter strings are padded with spaces, on the
+ * left if right is TRUE, and longer ones are cut, keeping their SGR sequences.
+ * @param layout pointer to the layout.
+ * @param str string to append.
+ * @param width columns the string must take.
+ * @param right TRUE to align the string to the right, FALSE to the left.
+ * @return OK if the string was appended, ERROR otherwise.
+ */
+STATUS layout_fit(Layout* layout, const char* str, int width, BOOL right);
+
+/**
+ * @brief Gets the line
+ *
+ * layout_get_string(Layout* layout) returns the line composed so far, which
+ * can be handed to screen_area_puts().
+ * @param layout pointer to the layout.
+ * @return the line, NULL if ERROR.
+ */
+char* layout_get_string(Layout* layout);
+
+/**
+ * @brief Gets the width of the line
+ *
+ * layout_get_width(Layout* layout) returns the columns taken by the line.
+ * @param layout pointer to the layout.
+ * @return the width of the line, -1 if ERROR.
+ */
+int layout_get_width(Layout* layout);
+
+/**
+ * @brief Measures a string
+ *
+ * layout_width(const char* str) returns the columns str takes on the terminal.
+ * @param str string to measure.
+ * @return the width of the string, -1 if ERROR.
+ */
+int layout_width(const char* str);
+
+#endif
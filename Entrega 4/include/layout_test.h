@@ -0,0 +1,41 @@
+/**
+ * @brief It declares the tests for the layout module
+ *
+ * @file layout_test.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef LAYOUT_TEST_H
+#define LAYOUT_TEST_H
+
+#include "layout.h"
+#include "test.h"
+
+
+void test1_layout_create();
+void test2_layout_create();
+
+void test1_layout_puts();
+void test2_layout_puts();
+void test3_layout_puts();
+
+void test1_layout_pad();
+void test2_layout_pad();
+void test3_layout_pad();
+
+void test1_layout_fit();
+void test2_layout_fit();
+void test3_layout_fit();
+void test4_layout_fit();
+
+void test1_layout_width();
+void test2_layout_width();
+void test3_layout_width();
+
+void test1_layout_clear();
+
+
+#endif
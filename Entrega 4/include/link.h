@@ -11,6 +11,8 @@
 #define LINK_H
 
 #include "types.h"
+#include "arena.h"
+#include "intern.h"
 
 typedef struct _Link Link;
 
@@ -25,6 +27,16 @@ typedef struct _Link Link;
  */
 Link* link_create(Id id);
 
+/**
+ * @brief Creates a link in an arena
+ *
+ * link_create_in(Arena* arena, Id id) creates a link whose memory comes from the arena
+ * @param arena arena of the link, NULL to use malloc()
+ * @param id, identifier of the link
+ * @return pointer to the link created, NULL otherwise
+ */
+Link* link_create_in(Arena* arena, Id id);
+
 /**
  * @brief Destroyes an link
  *
@@ -63,6 +75,28 @@ STATUS link_set_name(Link* link, char* name);
  */
 const char* link_get_name(Link* link);
 
+/**
+ * @brief Gets the handle of the name of a link
+ *
+ * link_get_name_handle(Link* link) gets the handle of the name in the table of strings
+ * of the link, so two links of the same table have the same name only if their
+ * handles are equal.
+ * @param link pointer to the link that we want get the name.
+ * @return handle of the name, NO_STRING if it is empty or ERROR.
+ */
+int link_get_name_handle(Link* link);
+
+/**
+ * @brief Sets the table of strings of a link
+ *
+ * link_set_intern(Link* link, Intern* strings) moves the name of the link to a table
+ * shared with other links, which must outlive the link.
+ * @param link pointer to the link.
+ * @param strings pointer to the table.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS link_set_intern(Link* link, Intern* strings);
+
 /**
  * @brief Sets the north for a link
  *
@@ -133,6 +167,17 @@ STATUS link_set_status(Link* link, LINKSTATUS status);
  */
 LINKSTATUS link_get_status(Link* link);
 
+/**
+ * @brief Sets where the status of a link is kept
+ *
+ * link_set_status_slot(Link* link, LINKSTATUS* slot) moves the status of the link to a
+ * slot outside it, so whoever owns the slot sees every change of the status at once.
+ * @param link pointer to the link.
+ * @param slot where the status is kept from now on, NULL to keep it in the link again.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS link_set_status_slot(Link* link, LINKSTATUS* slot);
+
 /**
  * @brief Prints a link
  *
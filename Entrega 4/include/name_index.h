@@ -0,0 +1,75 @@
+/**
+ * @brief Defines an index of entities by their name (name_index)
+ *
+ * @file name_index.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+#include "types.h"
+
+typedef struct _Name_index Name_index;
+
+/**
+ * @brief Creates an index of names
+ *
+ * name_index_create(BOOL ignore_case) creates an empty index.
+ * @param ignore_case TRUE if names differing only in case are the same name.
+ * @return pointer to the index created, NULL otherwise
+ */
+Name_index* name_index_create(BOOL ignore_case);
+
+/**
+ * @brief Destroyes an index of names
+ *
+ * name_index_destroy(Name_index* index) destroyes the index, not the entities in it.
+ * @param index pointer to the index we want to destroy.
+ */
+void name_index_destroy(Name_index* index);
+
+/**
+ * @brief Empties an index of names
+ *
+ * name_index_clear(Name_index* index) removes every name, keeping the memory for the next ones.
+ * @param index pointer to the index.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS name_index_clear(Name_index* index);
+
+/**
+ * @brief Adds a name
+ *
+ * name_index_add(Name_index* index, const char* name, void* entity) adds an entity
+ * under its name. If the name is already there the first entity added keeps it.
+ * The name is not copied, so it must live as long as the index.
+ * @param index pointer to the index.
+ * @param name name of the entity.
+ * @param entity pointer to the entity.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS name_index_add(Name_index* index, const char* name, void* entity);
+
+/**
+ * @brief Finds an entity by its name
+ *
+ * name_index_find(Name_index* index, const char* name) gets the first entity added with the name.
+ * @param index pointer to the index.
+ * @param name name to look for.
+ * @return pointer to the entity, NULL if no entity has the name or ERROR.
+ */
+void* name_index_find(Name_index* index, const char* name);
+
+/**
+ * @brief Gets the number of names
+ *
+ * name_index_get_number_of_names(Name_index* index) returns how many different names the index has.
+ * @param index pointer to the index.
+ * @return number of names, -1 if ERROR.
+ */
+int name_index_get_number_of_names(Name_index* index);
+
+#endif
@@ -0,0 +1,30 @@
+/**
+ * @brief It declares the tests for the name_index module
+ *
+ * @file name_index_test.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef NAME_INDEX_TEST_H
+#define NAME_INDEX_TEST_H
+
+#include "name_index.h"
+#include "test.h"
+
+
+void test1_name_index_create();
+void test1_name_index_add();
+void test2_name_index_add();
+void test3_name_index_add();
+void test1_name_index_find();
+void test2_name_index_find();
+void test3_name_index_find();
+void test4_name_index_find();
+void test1_name_index_clear();
+void test1_name_index_get_number_of_names();
+
+
+#endif
@@ -12,6 +12,9 @@
 #define OBJECT_H
 
 #include "types.h"
+#include "arena.h"
+#include "intern.h"
+#include "object_table.h"
 #include "set.h"
 
 
@@ -27,6 +30,16 @@ typedef struct _Object Object;
  */
 Object* object_create(Id id);
 
+/**
+ * @brief Creates an object in an arena
+ *
+ * object_create_in(Arena* arena, Id id) creates an object whose memory comes from the arena
+ * @param arena arena of the object, NULL to use malloc()
+ * @param id, identifier of the object
+ * @return pointer to the object created, NULL otherwise
+ */
+Object* object_create_in(Arena* arena, Id id);
+
 /**
  * @brief Destroyes an object
  *
@@ -155,6 +168,49 @@ STATUS object_set_turnedon(Object* object, BOOL turnedon);
  */
 const char* object_get_name(Object* object);
 
+/**
+ * @brief Gets the handle of the name of an object
+ *
+ * object_get_name_handle(Object* object) gets the handle of the name in the table of
+ * strings of the object, so two objects of the same table have the same name only
+ * if their handles are equal.
+ * @param object pointer to the object that we want get the name.
+ * @return handle of the name, NO_STRING if it is empty or ERROR.
+ */
+int object_get_name_handle(Object* object);
+
+/**
+ * @brief Sets the table of strings of an object
+ *
+ * object_set_intern(Object* object, Intern* strings) moves the name and descriptions of
+ * the object to a table shared with other objects, which must outlive the object.
+ * @param object pointer to the object.
+ * @param strings pointer to the table.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS object_set_intern(Object* object, Intern* strings);
+
+/**
+ * @brief Sets the table of state of an object
+ *
+ * object_set_table(Object* object, Object_table* table) moves the flags of the object
+ * and the link it opens to a row of a table shared with other objects, which must
+ * outlive the object.
+ * @param object pointer to the object.
+ * @param table pointer to the table.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS object_set_table(Object* object, Object_table* table);
+
+/**
+ * @brief Gets the table of state of an object
+ *
+ * object_get_table(Object* object) gets the table with the flags of the object.
+ * @param object pointer to the object.
+ * @return pointer to the table, NULL if the object has no state yet or ERROR.
+ */
+Object_table* object_get_table(Object* object);
+
 /**
  * @brief Gets the description of an object
  *
@@ -0,0 +1,172 @@
+/**
+ * @brief Defines a table with the state of the objects (object_table)
+ *
+ * @file object_table.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#ifndef OBJECT_TABLE_H
+#define OBJECT_TABLE_H
+
+#include "types.h"
+#include "set.h"
+
+#define NO_ROW -1         /*!< Row of an object not in a table */
+
+/**
+ * @brief Flags of an object, they can be joined with | to ask for several at once
+ */
+typedef enum {
+  OBJECT_MOVABLE = 1,     /*!< The player can take the object */
+  OBJECT_MOVED = 2,       /*!< The object has been moved */
+  OBJECT_HIDDEN = 4,      /*!< The object is hidden */
+  OBJECT_ILLUMINATE = 8,  /*!< The object can illuminate a space */
+  OBJECT_TURNEDON = 16    /*!< The object is turned on */
+} OBJECT_FLAG;
+
+typedef struct _Object_table Object_table;
+
+/**
+ * @brief Creates a table of objects
+ *
+ * object_table_create() creates an empty table. Each flag is kept as a column of
+ * bits, one per row, so the objects with some flags can be found a word at a time.
+ * @return pointer to the table created, NULL otherwise
+ */
+Object_table* object_table_create();
+
+/**
+ * @brief Destroyes a table of objects
+ *
+ * object_table_destroy(Object_table* table) destroyes the table and every row in it.
+ * @param table pointer to the table we want to destroy.
+ */
+void object_table_destroy(Object_table* table);
+
+/**
+ * @brief Adds an object
+ *
+ * object_table_add(Object_table* table, Id id) adds a row for the object, with
+ * every flag FALSE, no link to open and no location.
+ * @param table pointer to the table.
+ * @param id identifier of the object.
+ * @return row of the object, NO_ROW if ERROR.
+ */
+int object_table_add(Object_table* table, Id id);
+
+/**
+ * @brief Gets the identifier of a row
+ *
+ * object_table_get_id(Object_table* table, int row) returns the object the row belongs to.
+ * @param table pointer to the table.
+ * @param row row of the object.
+ * @return identifier of the object, NO_ID if ERROR.
+ */
+Id object_table_get_id(Object_table* table, int row);
+
+/**
+ * @brief Gets the row of an object
+ *
+ * object_table_get_row(Object_table* table, Id id) looks for the row of an object by
+ * its identifier, the first one if it was added more than once.
+ * @param table pointer to the table.
+ * @param id identifier of the object.
+ * @return row of the object, NO_ROW if it is not in the table or ERROR.
+ */
+int object_table_get_row(Object_table* table, Id id);
+
+/**
+ * @brief Sets a flag
+ *
+ * object_table_set_flag(Object_table* table, int row, OBJECT_FLAG flag, BOOL value)
+ * sets one flag of an object.
+ * @param table pointer to the table.
+ * @param row row of the object.
+ * @param flag flag to set.
+ * @param value new value of the flag.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS object_table_set_flag(Object_table* table, int row, OBJECT_FLAG flag, BOOL value);
+
+/**
+ * @brief Gets a flag
+ *
+ * object_table_get_flag(Object_table* table, int row, OBJECT_FLAG flag) gets one flag of an object.
+ * @param table pointer to the table.
+ * @param row row of the object.
+ * @param flag flag to get.
+ * @return value of the flag, FALSE if ERROR.
+ */
+BOOL object_table_get_flag(Object_table* table, int row, OBJECT_FLAG flag);
+
+/**
+ * @brief Sets the link an object opens
+ *
+ * object_table_set_open(Object_table* table, int row, Id id_link) sets the link
+ * the object can open.
+ * @param table pointer to the table.
+ * @param row row of the object.
+ * @param id_link identifier of the link, NO_ID if none.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS object_table_set_open(Object_table* table, int row, Id id_link);
+
+/**
+ * @brief Gets the link an object opens
+ *
+ * object_table_get_open(Object_table* table, int row) gets the link the object can open.
+ * @param table pointer to the table.
+ * @param row row of the object.
+ * @return identifier of the link, NO_ID if none or ERROR.
+ */
+Id object_table_get_open(Object_table* table, int row);
+
+/**
+ * @brief Sets where an object is
+ *
+ * object_table_set_location(Object_table* table, int row, Id location) sets where the
+ * object is, it is up to the owner of the table what a location means.
+ * @param table pointer to the table.
+ * @param row row of the object.
+ * @param location where the object is, NO_ID if nowhere.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS object_table_set_location(Object_table* table, int row, Id location);
+
+/**
+ * @brief Gets where an object is
+ *
+ * object_table_get_location(Object_table* table, int row) gets where the object is.
+ * @param table pointer to the table.
+ * @param row row of the object.
+ * @return where the object is, NO_ID if nowhere or ERROR.
+ */
+Id object_table_get_location(Object_table* table, int row);
+
+/**
+ * @brief Finds objects by their flags
+ *
+ * object_table_find(Object_table* table, int with, int without, Set* within, Set* found)
+ * looks for the objects that have every flag of with and none of without, for example
+ * OBJECT_ILLUMINATE | OBJECT_TURNEDON for the objects giving light.
+ * @param table pointer to the table.
+ * @param with flags the objects must have, joined with |.
+ * @param without flags the objects must not have, joined with |.
+ * @param within only the objects of this set are looked at, NULL for all of them.
+ * @param found set the objects found are added to, NULL to only count them.
+ * @return number of objects found, -1 if ERROR.
+ */
+int object_table_find(Object_table* table, int with, int without, Set* within, Set* found);
+
+/**
+ * @brief Gets the number of rows
+ *
+ * object_table_get_number_of_rows(Object_table* table) returns how many objects the table has.
+ * @param table pointer to the table.
+ * @return number of rows, -1 if ERROR.
+ */
+int object_table_get_number_of_rows(Object_table* table);
+
+#endif
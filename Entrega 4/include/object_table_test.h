@@ -0,0 +1,31 @@
+/**
+ * @brief It declares the tests for the object_table module
+ *
+ * @file object_table_test.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef OBJECT_TABLE_TEST_H
+#define OBJECT_TABLE_TEST_H
+
+#include "object_table.h"
+#include "test.h"
+
+
+void test1_object_table_create();
+void test1_object_table_add();
+void test2_object_table_add();
+void test1_object_table_set_flag();
+void test2_object_table_set_flag();
+void test1_object_table_set_open();
+void test1_object_table_find();
+void test2_object_table_find();
+void test3_object_table_find();
+void test4_object_table_find();
+void test5_object_table_find();
+
+
+#endif
@@ -44,6 +44,10 @@ void test2_object_has_object();
 void test1_object_get_name();
 void test2_object_get_name();
 
+void test1_object_get_name_handle();
+void test1_object_set_intern();
+void test2_object_set_intern();
+
 
 
 
@@ -11,7 +11,9 @@
 #define PLAYER_H
 
 #include "types.h"
+#include "arena.h"
 #include "inventory.h"
+#include "intern.h"
 
 typedef struct _Player Player;
 
@@ -24,6 +26,17 @@ typedef struct _Player Player;
  */
 Player* player_create(Id id, int maxobjects);
 
+/**
+ * @brief Creates a player in an arena
+ *
+ * player_create_in(Arena* arena, Id id, int maxobjects) creates a player whose memory comes from the arena
+ * @param arena arena of the player, NULL to use malloc()
+ * @param id, identifier of the player
+ * @param maxobjects max number of objects the player can carry
+ * @return pointer to the player created, NULL otherwise
+ */
+Player* player_create_in(Arena* arena, Id id, int maxobjects);
+
 /**
  * @brief Destroyes an object
  *
@@ -75,6 +88,17 @@ STATUS player_set_object(Player* player, Id id);
  */
 const char * player_get_name(Player* player);
 
+/**
+ * @brief Sets the table of strings of a player
+ *
+ * player_set_intern(Player* player, Intern* strings) moves the name of the player to a
+ * table shared with the rest of the game, which must outlive the player.
+ * @param player pointer to the player.
+ * @param strings pointer to the table.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS player_set_intern(Player* player, Intern* strings);
+
 /**
  * @brief Gets the location of a player.
  *
@@ -94,6 +118,16 @@ Id player_get_location(Player* player);
  */
 Id player_get_object(Player* player, int index);
 
+/**
+ * @brief Gets every object of a player
+ *
+ * player_get_objects(Player* player, int* n) Gets the objects the player carries at once.
+ * @param player, pointer to the player.
+ * @param n, where the number of objects is written.
+ * @return array of the identifiers of the objects, NULL otherwise.
+ */
+const Id* player_get_objects(Player* player, int* n);
+
 /**
  * @brief Gets a player's inventory max objects
  * player_get_maxobjects(Player* player) Gets the maximun number of objects of the inventory of the player
@@ -10,6 +10,9 @@
 #ifndef __SCREEN__
 #define __SCREEN__
 
+#include <stdio.h>
+#include "types.h"
+
 #define SCREEN_MAX_STR 80    /*!<Maximum number of characters to print on screen */
 
 typedef struct _Area Area;
@@ -17,11 +20,20 @@ typedef struct _Area Area;
 /**
  * @brief Initializes data on a screen.
  *
- * screen_init() Initializes data on a screen.
+ * screen_init() allocates the frame buffer once, big enough for every area
+ * created so far filled up plus the borders, so the areas must be created first.
  * @return no return.
  */
 void  screen_init();
 
+/**
+ * @brief Empties the frame buffer.
+ *
+ * screen_reset() empties the frame buffer allocated by screen_init() so the
+ * next frame can be composed on it, without reallocating it.
+ */
+void  screen_reset();
+
 /**
  * @brief Destruyes a screen.
  *
@@ -41,11 +53,38 @@ void  screen_area_clear(Area* area);
 /**
  * @brief Prints data
  *
- * screen_paint() print the screen data on the terminal
- *
+ * screen_paint() print the screen data on the terminal followed by the prompt.
+ * The whole frame is sent with a single write.
  */
 void  screen_paint(Area* area1, Area* area2, Area* area3, Area* area4, Area* area5);
 
+/**
+ * @brief Prints data as plain text
+ *
+ * screen_snapshot() writes the screen data on a file, one terminal row per line and
+ * without control sequences, followed by an empty line.
+ * @param file file the frame is written on.
+ */
+void  screen_snapshot(FILE* file, Area* area1, Area* area2, Area* area3, Area* area4, Area* area5);
+
+/**
+ * @brief Reports what every frame costs
+ *
+ * screen_set_stats(FILE* file) makes screen_paint() write on file, for every frame,
+ * the bytes sent to the terminal and the writes it took.
+ * @param file file the report is written on, NULL to stop reporting.
+ */
+void  screen_set_stats(FILE* file);
+
+/**
+ * @brief Tells the screen if the terminal shows UTF-8
+ *
+ * screen_set_utf8(BOOL utf8) makes screen_area_puts() keep UTF-8 characters as they
+ * are (TRUE) or replace them by an ASCII fallback, which is the default (FALSE).
+ * @param utf8 TRUE if the terminal shows UTF-8, FALSE otherwise.
+ */
+void  screen_set_utf8(BOOL utf8);
+
 
 /**
  * @brief Initialize the area to print
@@ -67,11 +106,59 @@ Area* screen_area_init(int size);
 void  screen_area_destroy(Area* area);
 
 /**
- * @brief Destroyes an aera
- * screen_area_destroy(Area* area) destroy the provided area
- * @param area pointer to the area we want to destroy
- *
+ * @brief Appends a string to an area
+ * screen_area_puts(Area* area, char *str) appends str at the end of the area,
+ * growing the area if it does not fit.
+ * @param area pointer to the area we want to write on
+ * @param str string to append
+ * @return OK if the string was appended, ERROR if the area could not grow
+ */
+STATUS screen_area_puts(Area* area, char *str);
+
+/**
+ * @brief Appends bytes to an area as they are
+ * screen_area_write(Area* area, const char *str, int len) appends the first len
+ * bytes of str at the end of the area without replacing special characters,
+ * for text that already went through screen_area_puts().
+ * @param area pointer to the area we want to write on
+ * @param str bytes to append
+ * @param len number of bytes to append
+ * @return OK if the bytes were appended, ERROR if the area could not grow
+ */
+STATUS screen_area_write(Area* area, const char *str, int len);
+
+/**
+ * @brief Marks an area as dirty or clean
+ * screen_area_set_dirty(Area* area, BOOL dirty) records whether what the area shows
+ * is out of date. Areas are created dirty; a clean area keeps its text between frames.
+ * @param area pointer to the area
+ * @param dirty TRUE if the area has to be written again, FALSE once it is written
+ * @return OK if the flag was set, ERROR otherwise
+ */
+STATUS screen_area_set_dirty(Area* area, BOOL dirty);
+
+/**
+ * @brief Tells if an area is dirty
+ * screen_area_is_dirty(Area* area) tells if the area has to be written again
+ * @param area pointer to the area
+ * @return TRUE if it is dirty, FALSE otherwise
+ */
+BOOL screen_area_is_dirty(Area* area);
+
+/**
+ * @brief Gets the text written on an area
+ * screen_area_get_string(Area* area) returns the text of the area
+ * @param area pointer to the area
+ * @return the text of the area, NULL if ERROR
+ */
+const char* screen_area_get_string(Area* area);
+
+/**
+ * @brief Gets the length of the text written on an area
+ * screen_area_get_length(Area* area) returns the length of the text of the area
+ * @param area pointer to the area
+ * @return number of bytes written on the area, -1 if ERROR
  */
-void  screen_area_puts(Area* area, char *str);
+int screen_area_get_length(Area* area);
 
 #endif
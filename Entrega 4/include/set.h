@@ -11,9 +11,19 @@
 #define SET_H
 
 #include "types.h"
+#include "arena.h"
 
 typedef struct _Set Set;
 
+/**
+ * @brief Implementations of a set
+ *
+ * A HASH_SET takes any identifier and keeps the order they were added in; a BIT_SET
+ * takes identifiers that are small, not negative integers and keeps them in
+ * increasing order, with a bit for each one.
+ */
+typedef enum {HASH_SET, BIT_SET} SET_TYPE;
+
 
 
 /**
@@ -24,6 +34,26 @@ typedef struct _Set Set;
  */
 Set* set_create();
 
+/**
+ * @brief Creates a set in an arena
+ *
+ * set_create_in(Arena* arena) creates a set whose memory comes from the arena
+ * @param arena arena of the set, NULL to use malloc()
+ * @return pointer to the set created, NULL otherwise
+ */
+Set* set_create_in(Arena* arena);
+
+/**
+ * @brief Creates a set of a given type
+ *
+ * set_create_type(Arena* arena, SET_TYPE type) creates a set implemented as a HASH_SET
+ * or a BIT_SET, whose memory comes from the arena
+ * @param arena arena of the set, NULL to use malloc()
+ * @param type implementation of the set
+ * @return pointer to the set created, NULL otherwise
+ */
+Set* set_create_type(Arena* arena, SET_TYPE type);
+
 /**
  * @brief Destroyes a set
  *
@@ -45,7 +75,8 @@ int set_get_num(Set *set);
 /**
  * @brief Adds a value to the set
  *
- * set_add(Set* set, Id id) add the identifier (id) to the set (set).
+ * set_add(Set* set, Id id) add the identifier (id) to the set (set), which grows
+ * as needed.
  * @param set pointer to set to which we want to add the id.
  * @param id identifier that we want to add
  * @return OK if the insert has been correct, ERROR otherwise.
@@ -65,7 +96,8 @@ STATUS set_del(Set* set, Id id);
 /**
  * @brief Takes a set value
  *
- * set_get(Set* set, int index) shows the element (index) of the set (set).
+ * set_get(Set* set, int index) shows the element (index) of the set (set). The
+ * identifiers keep the order in which they were added.
  * @param set, set pointer from which we want to take the id.
  * @param index, index of the set from which we want to get the id.
  * @return identifier we want to get, NO_ID otherwise.
@@ -0,0 +1,28 @@
+/**
+ * @brief Defines the optimiser of ANSI colour sequences (sgr)
+ *
+ * @file sgr.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#ifndef SGR_H
+#define SGR_H
+
+#include "types.h"
+
+/**
+ * @brief Minimises the SGR sequences of a line
+ *
+ * sgr_minimise(char* str) rewrites in place the SGR sequences (\033[...m) of str so
+ * that, before every character, only the attributes that change are sent, in the
+ * shortest of resetting or switching them one by one. The line is assumed to start
+ * with the default attributes and ends with the same attributes it ended with before.
+ * Lines with attributes it does not know are left as they are.
+ * @param str line to rewrite.
+ * @return length of the line once rewritten, -1 if ERROR.
+ */
+int sgr_minimise(char* str);
+
+#endif
@@ -0,0 +1,28 @@
+/**
+ * @brief It declares the tests for the sgr module
+ *
+ * @file sgr_test.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef SGR_TEST_H
+#define SGR_TEST_H
+
+#include "sgr.h"
+#include "test.h"
+
+
+void test1_sgr_minimise();
+void test2_sgr_minimise();
+void test3_sgr_minimise();
+void test4_sgr_minimise();
+void test5_sgr_minimise();
+void test6_sgr_minimise();
+void test7_sgr_minimise();
+void test8_sgr_minimise();
+
+
+#endif
@@ -11,7 +11,9 @@
 #define SPACE_H
 
 #include "types.h"
+#include "arena.h"
 #include "set.h"
+#include "intern.h"
 
 typedef struct _Space Space;
 
@@ -25,6 +27,16 @@ typedef struct _Space Space;
  * @return pointer to the space created, NULL otherwise
  */
 Space* space_create(Id id);
+
+/**
+ * @brief Creates a space in an arena
+ *
+ * space_create_in(Arena* arena, Id id) creates a space whose memory comes from the arena
+ * @param arena arena of the space, NULL to use malloc()
+ * @param id, identifier of the space
+ * @return pointer to the space created, NULL otherwise
+ */
+Space* space_create_in(Arena* arena, Id id);
 /**
  * @brief Destroyes an space
  *
@@ -92,9 +104,10 @@ const char* space_get_description(Space* space);
 STATUS space_set_full_description(Space* space, char* full_description);
 
 /**
- * @brief Gets the full description of a space if the space is illuminated
+ * @brief Gets the full description of a space
  *
- * space_get_description(space* space) gets the description of the obejct (space) to use it in the inspect command.
+ * space_get_description(space* space) gets the description of the obejct (space) to use it in the inspect command,
+ * whether there is light to see it is up to the game.
  * @param space pointer to the space that we want get the full description.
  * @return character string that is the description obtained.
  */
@@ -209,6 +222,15 @@ STATUS space_set_down(Space* space, Id id);
  */
 Id space_get_down(Space* space);
 
+/**
+ * @brief Gets the version of the links of the spaces
+ *
+ * space_get_links_version() returns a number that changes every time the link of
+ * any space in any direction is set, so a game can tell its graph is old.
+ * @return the version of the links
+ */
+long space_get_links_version();
+
 
 /**
  * @brief Sets an object to a space
@@ -240,6 +262,16 @@ Id space_get_object(Space* space, int index);
  */
 STATUS space_del_object(Space* space, Id id);
 
+/**
+ * @brief Checks if a space has an object
+ *
+ * space_has_object(Space* space, Id id) checks if the object is in the space
+ * @param space pointer to the space
+ * @param id of the object
+ * @return TRUE if the object is in the space, FALSE otherwise
+ */
+BOOL space_has_object(Space* space, Id id);
+
 /**
  * @brief Gets the number of objects of a space
  *
@@ -267,6 +299,17 @@ const char* space_get_gdesc(Space* space, int line);
  */
 STATUS space_set_gdesc(Space* space, char* gdesc, int line);
 
+/**
+ * @brief Sets the table of strings of a space
+ *
+ * space_set_intern(Space* space, Intern* strings) moves the name, descriptions and lines
+ * of the graphic description to a table shared with other spaces, which must outlive the space
+ * @param pointer to the space
+ * @param pointer to the table
+ * @return ERROR in the case there had been any problem, OK if the process is completed succesfully
+ */
+STATUS space_set_intern(Space* space, Intern* strings);
+
 /**
  * @brief Gets the lighting status of a space
  *
@@ -86,5 +86,8 @@ void test2_space_get_gdesc();
 void test1_space_set_gdesc();
 void test2_space_set_gdesc();
 
+void test1_space_set_intern();
+void test2_space_set_intern();
+
 
 #endif
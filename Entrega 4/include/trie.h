@@ -0,0 +1,104 @@
+/**
+ * @brief Defines a prefix tree of words (trie)
+ *
+ * @file trie.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#ifndef TRIE_H
+#define TRIE_H
+
+#include "types.h"
+
+#define NO_MATCH -1   /*!< Value of a word not in a trie */
+
+typedef struct _Trie Trie;
+
+/**
+ * @brief Creates a prefix tree
+ *
+ * trie_create(BOOL ignore_case) creates an empty tree. Words are looked for one
+ * character at a time, so finding one takes as long as the word, whatever the
+ * number of words in the tree.
+ * @param ignore_case TRUE if words differing only in case are the same word.
+ * @return pointer to the tree created, NULL otherwise
+ */
+Trie* trie_create(BOOL ignore_case);
+
+/**
+ * @brief Destroyes a prefix tree
+ *
+ * trie_destroy(Trie* trie) destroyes the tree.
+ * @param trie pointer to the tree we want to destroy.
+ */
+void trie_destroy(Trie* trie);
+
+/**
+ * @brief Empties a prefix tree
+ *
+ * trie_clear(Trie* trie) removes every word, keeping the memory for the next ones.
+ * @param trie pointer to the tree.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS trie_clear(Trie* trie);
+
+/**
+ * @brief Adds a word
+ *
+ * trie_add(Trie* trie, const char* word, int value) adds a word with its value. If the
+ * word is already there the first value added is kept. The word is not copied, so it
+ * must live as long as the tree.
+ * @param trie pointer to the tree.
+ * @param word word to add.
+ * @param value value of the word, not negative.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS trie_add(Trie* trie, const char* word, int value);
+
+/**
+ * @brief Finds a word
+ *
+ * trie_find(Trie* trie, const char* word) gets the value of a word.
+ * @param trie pointer to the tree.
+ * @param word word to look for.
+ * @return value of the word, NO_MATCH if it is not in the tree or ERROR.
+ */
+int trie_find(Trie* trie, const char* word);
+
+/**
+ * @brief Finds a word by its beginning
+ *
+ * trie_find_prefix(Trie* trie, const char* prefix) gets the value of the word that is
+ * the prefix itself or, if there is none, of the only word starting with it.
+ * @param trie pointer to the tree.
+ * @param prefix beginning of the word.
+ * @return value of the word, NO_MATCH if no word or more than one start with the prefix or ERROR.
+ */
+int trie_find_prefix(Trie* trie, const char* prefix);
+
+/**
+ * @brief Gets the words starting with a prefix
+ *
+ * trie_complete(Trie* trie, const char* prefix, const char** words, int max) gets
+ * the words starting with the prefix in alphabetical order, for completing what the
+ * user is typing.
+ * @param trie pointer to the tree.
+ * @param prefix beginning of the words.
+ * @param words where the first max words are written, it may be NULL if max is 0.
+ * @param max room in words.
+ * @return number of words starting with the prefix, even if more than max, -1 if ERROR.
+ */
+int trie_complete(Trie* trie, const char* prefix, const char** words, int max);
+
+/**
+ * @brief Gets the number of words
+ *
+ * trie_get_number_of_words(Trie* trie) returns how many different words the tree has.
+ * @param trie pointer to the tree.
+ * @return number of words, -1 if ERROR.
+ */
+int trie_get_number_of_words(Trie* trie);
+
+#endif
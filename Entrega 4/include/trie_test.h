@@ -0,0 +1,32 @@
+/**
+ * @brief It declares the tests for the trie module
+ *
+ * @file trie_test.h
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef TRIE_TEST_H
+#define TRIE_TEST_H
+
+#include "trie.h"
+#include "test.h"
+
+
+void test1_trie_create();
+void test1_trie_add();
+void test2_trie_add();
+void test3_trie_add();
+void test1_trie_find();
+void test2_trie_find();
+void test1_trie_find_prefix();
+void test2_trie_find_prefix();
+void test1_trie_complete();
+void test2_trie_complete();
+void test1_trie_clear();
+void test1_trie_get_number_of_words();
+
+
+#endif
@@ -16,22 +16,14 @@
 
 /* Id macros */
 #define NO_ID -1         /*!< No identifier */
-#define MAX_ID 120      /*!< Max number of identifiers */
 
 /* Graphic description macros */
 #define MAX_GDESC_LINES 51     /*!< Max graphic description lines */
 #define MAX_GDESC_LENGTH 4096    /*!< Graphic description length */
 
 /* Space macros */
-#define MAX_SPACES 120        /*!< Max number of spaces */
 #define FIRST_SPACE 1         /*!< Number of the first space */
 
-/* Object macros */
-#define MAX_OBJECTS 120       /*!< Max number of objects */
-
-/* Link macros */
-#define MAX_LINKS 120         /*!< Max number of links */
-
 /* Die macros */
 #define DEFAULT_DIE_VALUE -1  /*!< Default die value */
 #define MIN_DIE 1             /*!< Min die value */
@@ -66,9 +58,13 @@ typedef enum {
   N,           /*!< North*/
   S,           /*!< South */
   E,           /*!< East */
-  W            /*!< west */
+  W,           /*!< west */
+  U,           /*!< Up */
+  D            /*!< Down */
 } DIRECTION;
 
+#define N_DIRECTIONS 6  /*!< Number of directions of a space */
+
 /**
 * @brief Link status values list
 */
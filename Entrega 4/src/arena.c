@@ -0,0 +1,241 @@
+/**
+ * @brief Defines an arena of memory (arena)
+ *
+ * @file arena.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+
+#define ARENA_CHUNK_SIZE 262144  /*!< Bytes of every chunk of arena_create() */
+
+/**
+ * @brief Alignment
+ *
+ * The most demanding types, whose size is the alignment of the memory given.
+ */
+typedef union {
+  long l;
+  double d;
+  void *p;
+} Arena_align;
+
+/**
+ * @brief Chunk
+ *
+ * This structure defines a chunk of memory taken from malloc().
+ */
+typedef struct _Arena_chunk {
+  struct _Arena_chunk *next;   /*!< Next chunk */
+  size_t size;                 /*!< Bytes of data */
+  size_t used;                 /*!< Bytes of data given */
+  Arena_align data[1];         /*!< Memory given */
+} Arena_chunk;
+
+/**
+ * @brief Arena
+ *
+ * This structure defines an arena.
+ */
+struct _Arena {
+  Arena_chunk *first;     /*!< Chunks of chunk_size, in order */
+  Arena_chunk *current;   /*!< Chunk memory is being given from */
+  Arena_chunk *large;     /*!< Chunks of a single allocation larger than a quarter of chunk_size */
+  size_t chunk_size;      /*!< Bytes of every chunk */
+  int n_chunks;           /*!< Number of chunks */
+  long size;              /*!< Bytes given */
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Allocates a chunk.
+ * @param size bytes of data of the chunk.
+ * @return the chunk, NULL if ERROR.
+ */
+Arena_chunk* arena_utils_chunk(size_t size);
+
+/**
+ * @brief Gives memory.
+ * @param arena pointer to the arena.
+ * @param size number of bytes.
+ * @param align alignment of the memory, 1 for none.
+ * @return pointer to the memory, NULL if ERROR.
+ */
+void* arena_utils_alloc(Arena* arena, size_t size, size_t align);
+
+/**
+ * @brief Bytes needed to align the next memory given by a chunk.
+ * @param chunk pointer to the chunk.
+ * @param align alignment.
+ * @return number of bytes.
+ */
+size_t arena_utils_padding(Arena_chunk* chunk, size_t align);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
+Arena* arena_create() {
+  return arena_create_size(ARENA_CHUNK_SIZE);
+}
+
+Arena* arena_create_size(size_t chunk_size) {
+  Arena *arena = NULL;
+
+  if (chunk_size == 0)
+    return NULL;
+
+  arena = (Arena *) malloc(sizeof(Arena));
+  if (!arena)
+    return NULL;
+
+  arena->first = NULL;
+  arena->current = NULL;
+  arena->large = NULL;
+  arena->chunk_size = chunk_size;
+  arena->n_chunks = 0;
+  arena->size = 0;
+
+  return arena;
+}
+
+void arena_destroy(Arena* arena) {
+  Arena_chunk *chunk = NULL;
+
+  if (!arena)
+    return;
+
+  arena_reset(arena);
+  while (arena->first) {
+    chunk = arena->first;
+    arena->first = chunk->next;
+    free(chunk);
+  }
+  free(arena);
+}
+
+void arena_reset(Arena* arena) {
+  Arena_chunk *chunk = NULL;
+
+  if (!arena)
+    return;
+
+  while (arena->large) {
+    chunk = arena->large;
+    arena->large = chunk->next;
+    free(chunk);
+    arena->n_chunks--;
+  }
+  for (chunk = arena->first; chunk; chunk = chunk->next) {
+    chunk->used = 0;
+  }
+  arena->current = arena->first;
+  arena->size = 0;
+}
+
+void* arena_alloc(Arena* arena, size_t size) {
+  if (!arena)
+    return malloc(size);
+
+  return arena_utils_alloc(arena, size, sizeof(Arena_align));
+}
+
+char* arena_strdup(Arena* arena, const char* str) {
+  char *copy = NULL;
+  size_t len;
+
+  if (!str)
+    return NULL;
+
+  len = strlen(str);
+  if (!arena)
+    copy = (char *) malloc(len + 1);
+  else
+    copy = (char *) arena_utils_alloc(arena, len + 1, 1);
+  if (!copy)
+    return NULL;
+  memcpy(copy, str, len + 1);
+
+  return copy;
+}
+
+void arena_free(Arena* arena, void* ptr) {
+  if (!arena)
+    free(ptr);
+}
+
+int arena_get_number_of_chunks(Arena* arena) {
+  if (!arena)
+    return -1;
+  return arena->n_chunks;
+}
+
+long arena_get_size(Arena* arena) {
+  if (!arena)
+    return -1;
+  return arena->size;
+}
+
+Arena_chunk* arena_utils_chunk(size_t size) {
+  Arena_chunk *chunk = NULL;
+
+  chunk = (Arena_chunk *) malloc(sizeof(Arena_chunk) + size);
+  if (!chunk)
+    return NULL;
+  chunk->next = NULL;
+  chunk->size = size;
+  chunk->used = 0;
+
+  return chunk;
+}
+
+size_t arena_utils_padding(Arena_chunk* chunk, size_t align) {
+  return (align - chunk->used % align) % align;
+}
+
+void* arena_utils_alloc(Arena* arena, size_t size, size_t align) {
+  Arena_chunk *chunk = NULL;
+  char *ptr = NULL;
+
+  if (size > arena->chunk_size / 4) {
+    /* Large allocations get a chunk of their own, so chunks are not wasted */
+    if ((chunk = arena_utils_chunk(size)) == NULL)
+      return NULL;
+    chunk->next = arena->large;
+    arena->large = chunk;
+    arena->n_chunks++;
+    arena->size += size;
+    return chunk->data;
+  }
+
+  while (arena->current && arena->current->size - arena->current->used < size + arena_utils_padding(arena->current, align)) {
+    if (!arena->current->next) {
+      if ((chunk = arena_utils_chunk(arena->chunk_size)) == NULL)
+        return NULL;
+      arena->current->next = chunk;
+      arena->n_chunks++;
+    }
+    arena->current = arena->current->next;
+  }
+  if (!arena->current) {
+    if ((chunk = arena_utils_chunk(arena->chunk_size)) == NULL)
+      return NULL;
+    arena->first = arena->current = chunk;
+    arena->n_chunks++;
+  }
+
+  arena->current->used += arena_utils_padding(arena->current, align);
+  ptr = (char *) arena->current->data + arena->current->used;
+  arena->current->used += size;
+  arena->size += size;
+
+  return ptr;
+}
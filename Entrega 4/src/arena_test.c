@@ -0,0 +1,150 @@
+/**
+ * @brief It tests arena module
+ *
+ * @file arena_test.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arena_test.h"
+#define MAX_TESTS 11
+
+/**
+ * @brief Main function to test arena module.
+ *
+ * Two execution options:
+ *   1.-If no parameters, all test will run
+ *   2.-If you run with a number between 1 and the number of tests just run
+ *      the indicated test
+ *
+ */
+int main(int argc, char** argv) {
+
+    int test = 0;
+    int all = 1;
+
+    if (argc < 2) {
+        printf("Running all test for module arena:\n");
+    } else {
+        test = atoi(argv[1]);
+        all = 0;
+        printf("Running test %d:\t", test);
+	if (test < 1 || test > MAX_TESTS) {
+	  printf("Error: unknown test %d\t", test);
+	  exit(EXIT_SUCCESS);
+        }
+    }
+
+
+    if (all || test == 1) test1_arena_create();
+    if (all || test == 2) test1_arena_alloc();
+    if (all || test == 3) test2_arena_alloc();
+    if (all || test == 4) test3_arena_alloc();
+    if (all || test == 5) test4_arena_alloc();
+    if (all || test == 6) test1_arena_strdup();
+    if (all || test == 7) test2_arena_strdup();
+    if (all || test == 8) test1_arena_reset();
+    if (all || test == 9) test2_arena_reset();
+    if (all || test == 10) test1_arena_create_size();
+    if (all || test == 11) test2_arena_create_size();
+
+
+    PRINT_PASSED_PERCENTAGE;
+
+    return EXIT_SUCCESS;
+}
+
+void test1_arena_create() {
+    Arena *arena = arena_create();
+    PRINT_TEST_RESULT(arena != NULL && arena_get_number_of_chunks(arena) == 0 && arena_get_size(arena) == 0);
+    arena_destroy(arena);
+}
+
+void test1_arena_create_size() {
+    Arena *arena = arena_create_size(256);
+    int i, ok = 1;
+    /* 40 allocations of 16 bytes do not fit in a chunk of 256 */
+    for (i = 0; i < 40; i++) {
+        if (arena_alloc(arena, 16) == NULL)
+            ok = 0;
+    }
+    PRINT_TEST_RESULT(ok && arena_get_number_of_chunks(arena) == 3 && arena_get_size(arena) == 640);
+    arena_destroy(arena);
+}
+
+void test2_arena_create_size() {
+    PRINT_TEST_RESULT(arena_create_size(0) == NULL);
+}
+
+void test1_arena_alloc() {
+    Arena *arena = arena_create();
+    char *a = arena_alloc(arena, 3);
+    char *b = arena_alloc(arena, 8);
+    PRINT_TEST_RESULT(a != NULL && b != NULL && b - a >= 3 && (b - a) % sizeof(long) == 0);
+    arena_destroy(arena);
+}
+
+void test2_arena_alloc() {
+    Arena *arena = arena_create();
+    int i, ok = 1;
+    for (i = 0; i < 1000; i++) {
+        if (arena_alloc(arena, 100) == NULL)
+            ok = 0;
+    }
+    PRINT_TEST_RESULT(ok && arena_get_number_of_chunks(arena) == 1);
+    arena_destroy(arena);
+}
+
+void test3_arena_alloc() {
+    Arena *arena = arena_create();
+    char *a = arena_alloc(arena, 1000000);
+    memset(a, 'x', 1000000);
+    PRINT_TEST_RESULT(a != NULL && arena_get_number_of_chunks(arena) == 1 && arena_get_size(arena) >= 1000000);
+    arena_destroy(arena);
+}
+
+void test4_arena_alloc() {
+    int *a = arena_alloc(NULL, sizeof(int));
+    PRINT_TEST_RESULT(a != NULL);
+    arena_free(NULL, a);
+}
+
+void test1_arena_strdup() {
+    Arena *arena = arena_create();
+    char *a = arena_strdup(arena, "gate");
+    PRINT_TEST_RESULT(a != NULL && strcmp(a, "gate") == 0 && arena_get_size(arena) == 5);
+    arena_destroy(arena);
+}
+
+void test2_arena_strdup() {
+    Arena *arena = arena_create();
+    PRINT_TEST_RESULT(arena_strdup(arena, NULL) == NULL);
+    arena_destroy(arena);
+}
+
+void test1_arena_reset() {
+    Arena *arena = arena_create();
+    char *a, *b;
+    a = arena_alloc(arena, 64);
+    arena_reset(arena);
+    b = arena_alloc(arena, 64);
+    PRINT_TEST_RESULT(a == b && arena_get_size(arena) == 64 && arena_get_number_of_chunks(arena) == 1);
+    arena_destroy(arena);
+}
+
+void test2_arena_reset() {
+    Arena *arena = arena_create();
+    int i;
+    for (i = 0; i < 3; i++) {
+        arena_alloc(arena, 1000000);
+        arena_alloc(arena, 10);
+        arena_reset(arena);
+    }
+    PRINT_TEST_RESULT(arena_get_number_of_chunks(arena) == 1 && arena_get_size(arena) == 0);
+    arena_destroy(arena);
+}
@@ -8,8 +8,8 @@
 */
 
 #include <stdio.h>
-#include <strings.h>
 #include "command.h"
+#include "trie.h"
 
 
 
@@ -17,20 +17,62 @@ char *cmd_to_str[N_CMD] = {"No command", "Unknown", "Exit", "Move", "Next", "Bac
 char *short_cmd_to_str[N_CMD] = {"","","e","m","n", "b", "r","l","t","d","rl", "i","ton", "toff" ,"o", "s", "ld"};                                       /*!< Abbreviation of the possible commands to enter */
 
 
+/**
+ * @brief Names and abbreviations of the commands, made the first time they are needed
+ */
+static Trie* command_words = NULL;
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Gets the tree of names and abbreviations of the commands, making it the first time
+ * @return the tree, NULL in case of error
+ */
+Trie* command_utils_words();
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
 T_Command command_get_user_input() {
   T_Command cmd = NO_CMD;
   char input[CMD_LENGTH] = "";
-  int i=UNKNOWN - NO_CMD + 1;
+  int i;
 
   if (scanf("%s", input) > 0) {
-    cmd = UNKNOWN;while(cmd == UNKNOWN && i < N_CMD) {
-      if (!strcasecmp(input,short_cmd_to_str[i]) || !strcasecmp(input, cmd_to_str[i])) {
-        cmd = i + NO_CMD;
-      }
-      else {
-	       i++;
-      }
-    }
+    /* A name, an abbreviation or the beginning of only one of them, whatever the case */
+    i = trie_find_prefix(command_utils_words(), input);
+    cmd = (i == NO_MATCH) ? UNKNOWN : i + NO_CMD;
   }
   return cmd;
 }
+
+int command_complete(const char* prefix, const char** words, int max) {
+  return trie_complete(command_utils_words(), prefix, words, max);
+}
+
+void command_free_words() {
+  trie_destroy(command_words);
+  command_words = NULL;
+}
+
+Trie* command_utils_words() {
+  int i;
+
+  if (command_words)
+    return command_words;
+
+  command_words = trie_create(TRUE);
+  if (!command_words)
+    return NULL;
+  for (i=UNKNOWN - NO_CMD + 1; i < N_CMD; i++) {
+    if (trie_add(command_words, short_cmd_to_str[i], i) == ERROR || trie_add(command_words, cmd_to_str[i], i) == ERROR) {
+      command_free_words();
+      return NULL;
+    }
+  }
+
+  return command_words;
+}
@@ -22,22 +22,28 @@ struct _Die{
   int min;                /*!< Die minimun value */
   int max;                /*!< Die maximun value */
   int last_value;         /*!< Die last value*/
+  Arena* arena;           /*!< Arena of the die, NULL if it comes from malloc() */
 };
 
 
 Die* die_create(Id id, int min, int max) {
+  return die_create_in(NULL, id, min, max);
+}
+
+Die* die_create_in(Arena* arena, Id id, int min, int max) {
   Die *die = NULL;
   srand(time(NULL));
 
   if (id == NO_ID)
     return NULL;
 
-  die = (Die*) malloc(sizeof (Die));
+  die = (Die*) arena_alloc(arena, sizeof (Die));
 
   if (die == NULL) {
     return NULL;
   }
   die->id = id;
+  die->arena = arena;
   die->min=min;
   die->max=max;
   die->last_value=DEFAULT_DIE_VALUE;
@@ -50,7 +56,7 @@ STATUS die_destroy(Die* die) {
     return ERROR;
   }
 
-  free(die);
+  arena_free(die->arena, die);
   die = NULL;
 
   return OK;
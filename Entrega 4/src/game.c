@@ -14,6 +14,10 @@
 #include <string.h>
 #include "game.h"
 #include "game_management.h"
+#include "graph.h"
+#include "name_index.h"
+#include "trie.h"
+#include "id_table.h"
 
 #define N_CALLBACK 16
 
@@ -24,10 +28,31 @@
  */
 struct _Game {
   Player* player;                       /*!< Game player */
-  Object* objects[MAX_OBJECTS + 1];     /*!< Game object */
-  Space* spaces[MAX_SPACES + 1];        /*!<Spaces in which the game takes place */
-  Link* links[MAX_LINKS + 1];           /*!<Game links*/
+  Object** objects;                     /*!< Game objects, ended by NULL */
+  int n_objects;                        /*!< Number of objects */
+  int max_objects;                      /*!< Room for objects before growing */
+  Space** spaces;                       /*!<Spaces in which the game takes place, ended by NULL */
+  int n_spaces;                         /*!<Number of spaces */
+  int max_spaces;                       /*!<Room for spaces before growing */
+  Link** links;                         /*!<Game links, ended by NULL*/
+  int n_links;                          /*!<Number of links */
+  int max_links;                        /*!<Room for links before growing */
+  Id_table* space_ids;                  /*!<Position of every space in spaces by its id*/
+  Id_table* object_ids;                 /*!<Position of every object in objects by its id*/
+  Id_table* link_ids;                   /*!<Position of every link in links by its id*/
   Die* die;                             /*!<Game die*/
+  Intern* strings;                      /*!<Names, descriptions and graphic descriptions of the world*/
+  Object_table* object_table;           /*!<Flags of every object and the links they open*/
+  Graph* graph;                         /*!<Neighbours of every space and the status of the links*/
+  BOOL graph_stale;                     /*!<TRUE if spaces or links were added since the graph was built*/
+  long links_version;                   /*!<Version of the links of the spaces the graph was built with*/
+  Name_index* object_names;             /*!<Objects by their name*/
+  Name_index* link_names;               /*!<Links by their name*/
+  Trie* object_words;                   /*!<Position of the objects by their name, for beginnings of names*/
+  Trie* link_words;                     /*!<Position of the links by their name, for beginnings of names*/
+  BOOL names_stale;                     /*!<TRUE if objects or links were added since the names were indexed*/
+  BOOL ignore_case;                     /*!<TRUE if names are looked for whatever their case*/
+  Arena* arena;                         /*!<Memory of the world, released all at once*/
   char description[WORD_SIZE +1];       /*!<Game description*/
   char full_description[WORD_SIZE +1];  /*!<Game full description*/
   char rules_string[WORD_SIZE+1];       /*!<Game rules string*/
@@ -35,9 +60,21 @@ struct _Game {
   T_Command last_cmd;                   /*!<Last command executed in the game*/
   STATUS status;                        /*!<Status of last command*/
   RUNNING_RULES run_rules;              /*!<Running the game with rules or without them*/
-
+  long map_version;                     /*!<Changes every time spaces or links change*/
+  long descript_version;                /*!<Changes every time the objects, the die or the inspected text change*/
 };
 
+/**
+ * @brief Last map version given to a game, so versions are never repeated
+ * even after a game is destroyed and a new one is loaded
+ */
+static long game_map_versions = 0;
+
+/**
+ * @brief Last description version given to a game, for the same reason
+ */
+static long game_descript_versions = 0;
+
 /**
  * @brief Defines the type of function for calls
  */
@@ -134,6 +171,67 @@ void game_callback_save(Game* game);
  */
 void game_callback_load(Game* game);
 
+/**
+ * @brief Creates an empty world (die and table of strings) in the arena of the game
+ * @param game pointer to the game.
+ * @return OK if the process is successful, ERROR in case of error
+ */
+STATUS game_world_create(Game* game);
+
+/**
+ * @brief Destroys the world of the game, except the memory of its arena
+ * @param game pointer to the game.
+ */
+void game_world_destroy(Game* game);
+
+/**
+ * @brief Makes room in a list of the game for one more entity and its final NULL
+ * @param list list of pointers to grow (it may be NULL).
+ * @param num number of entities in the list.
+ * @param max room of the list, updated if it grows.
+ * @param size size of each pointer of the list.
+ * @return the list, moved if it had to grow, or NULL in case of error (the list is kept)
+ */
+void* game_utils_grow(void* list, int num, int* max, size_t size);
+
+/**
+ * @brief Gets the graph of the game, building it again if spaces or links were added
+ * @param game pointer to the game.
+ * @return the graph, NULL in case of error
+ */
+Graph* game_utils_graph(Game* game);
+
+/**
+ * @brief Indexes the names of the objects and links again if any were added
+ * @param game pointer to the game.
+ * @return OK if the process is successful, ERROR in case of error
+ */
+STATUS game_utils_names(Game* game);
+
+/**
+ * @brief Moves the player through the link of its space in a direction
+ * @param game pointer to the game.
+ * @param dir direction to move to.
+ */
+void game_utils_move(Game* game, DIRECTION dir);
+
+/**
+ * @brief Gets the direction a word of the move command stands for
+ * @param word name or abbreviation of the direction.
+ * @return the direction, -1 if the word is not a direction
+ */
+int game_utils_direction(const char* word);
+
+
+/**
+ * @brief Names of the directions for the move command, in the order of DIRECTION
+ */
+static char *game_dir_to_str[N_DIRECTIONS] = {"north", "south", "east", "west", "up", "down"};
+
+/**
+ * @brief Abbreviations of the directions for the move command, in the order of DIRECTION
+ */
+static char *game_short_dir_to_str[N_DIRECTIONS] = {"n", "s", "e", "w", "u", "d"};
 
 /**
  * @brief Call list for each game command
@@ -162,61 +260,206 @@ void game_callback_load(Game* game);
 */
 
 Game* game_create() {
-  int i;
   Game* game=NULL;
   game=(Game*)malloc(sizeof(Game));
   if (game==NULL)
     return NULL;
 
-  for (i = 0; i < MAX_SPACES; i++) {
-    game->spaces[i] = NULL;
-  }
-  for (i = 0; i < MAX_OBJECTS; i++) {
-    game->objects[i] = NULL;
+  /* The lists grow with the world and are kept when it is reset, so they do not live in the arena */
+  game->objects = NULL;
+  game->spaces = NULL;
+  game->links = NULL;
+  game->max_objects = game->max_spaces = game->max_links = 0;
+  game->n_objects = game->n_spaces = game->n_links = 0;
+  game->ignore_case = FALSE;
+  game->arena = arena_create();
+  if (game->arena==NULL || game_world_create(game)==ERROR) {
+    game_destroy(game);
+    return NULL;
   }
-  for (i=0; i< MAX_LINKS; i++) {
-    game->links[i] = NULL;
+  game->run_rules = NO_RULE;
+
+  return game;
+}
+
+STATUS game_destroy(Game* game) {
+  if (game==NULL)
+    return ERROR;
+
+  if (game->arena) {
+    game_world_destroy(game);
+    arena_destroy(game->arena);
   }
+  free(game->objects);
+  free(game->spaces);
+  free(game->links);
+  free(game);
 
-  game->player = NULL;
-  game->die=die_create(0, MIN_DIE, MAX_DIE);
-  if (game->die==NULL) {
-    game_destroy(game);
+  return OK;
+}
+
+STATUS game_reset(Game* game) {
+  if (game==NULL)
+    return ERROR;
+
+  game_world_destroy(game);
+  arena_reset(game->arena);
+
+  return game_world_create(game);
+}
+
+Arena* game_get_arena(Game* game) {
+  if (game==NULL)
     return NULL;
-  }
+  return game->arena;
+}
+
+STATUS game_world_create(Game* game) {
+  game->n_spaces = game->n_objects = game->n_links = 0;
+  if (game->spaces)
+    game->spaces[0] = NULL;
+  if (game->objects)
+    game->objects[0] = NULL;
+  if (game->links)
+    game->links[0] = NULL;
+
+  game->player = NULL;
+  game->strings = intern_create(game->arena);
+  game->object_table = object_table_create();
+  game->graph = graph_create();
+  game->graph_stale = TRUE;
+  game->links_version = -1;
+  game->object_names = name_index_create(game->ignore_case);
+  game->link_names = name_index_create(game->ignore_case);
+  game->object_words = trie_create(game->ignore_case);
+  game->link_words = trie_create(game->ignore_case);
+  game->names_stale = TRUE;
+  game->space_ids = id_table_create();
+  game->object_ids = id_table_create();
+  game->link_ids = id_table_create();
+  game->die = die_create_in(game->arena, 0, MIN_DIE, MAX_DIE);
   game->description[0]='\0';
   game->full_description[0]='\0';
   game->rules_string[0]='\0';
   game->last_cmd = NO_CMD;
   game->new_cmd = NO_CMD;
   game->status = OK;
-  game->run_rules = NO_RULE;
+  game->map_version = ++game_map_versions;
+  game->descript_version = ++game_descript_versions;
 
-  return game;
+  if (game->die==NULL || game->strings==NULL || game->object_table==NULL || game->graph==NULL ||
+      game->object_names==NULL || game->link_names==NULL || game->object_words==NULL || game->link_words==NULL ||
+      game->space_ids==NULL || game->object_ids==NULL || game->link_ids==NULL)
+    return ERROR;
+
+  return OK;
 }
 
-STATUS game_destroy(Game* game) {
+void game_world_destroy(Game* game) {
   int i = 0;
 
-  for (i = 0; (i < MAX_SPACES) && (game->spaces[i] != NULL); i++) {
+  /* The graph gives the links their status back, so it goes before them */
+  graph_destroy(game->graph);
+  game->graph = NULL;
+
+  /* Whatever came from the arena is released with it, this only frees what did not */
+  for (i = 0; i < game->n_spaces; i++) {
     space_destroy(game->spaces[i]);
   }
-  for(i = 0; (i < MAX_OBJECTS) && (game->objects[i] != NULL); i++) {
+  for(i = 0; i < game->n_objects; i++) {
     object_destroy(game->objects[i]);
   }
-  for(i = 0; (i < MAX_LINKS) && (game->links[i] != NULL); i++) {
+  for(i = 0; i < game->n_links; i++) {
     link_destroy(game->links[i]);
   }
+  game->n_spaces = game->n_objects = game->n_links = 0;
+  player_destroy(game->player);
+  die_destroy(game->die);
+  intern_destroy(game->strings);
+  object_table_destroy(game->object_table);
+  name_index_destroy(game->object_names);
+  name_index_destroy(game->link_names);
+  game->object_names = NULL;
+  game->link_names = NULL;
+  trie_destroy(game->object_words);
+  trie_destroy(game->link_words);
+  game->object_words = NULL;
+  game->link_words = NULL;
+  id_table_destroy(game->space_ids);
+  id_table_destroy(game->object_ids);
+  id_table_destroy(game->link_ids);
+  game->space_ids = NULL;
+  game->object_ids = NULL;
+  game->link_ids = NULL;
+  game->player = NULL;
+  game->die = NULL;
+  game->strings = NULL;
+  game->object_table = NULL;
+}
 
-  if (player_destroy(game->player)==ERROR)
-    return ERROR;
-  if (die_destroy(game->die)==ERROR)
-    return ERROR;
-  free(game);
+void* game_utils_grow(void* list, int num, int* max, size_t size) {
+  void* aux = NULL;
+  int new_max;
+
+  /* One slot is always left for the final NULL */
+  if (num + 1 < *max)
+    return list;
 
+  new_max = (*max > 0) ? 2 * (*max) : 16;
+  aux = realloc(list, new_max * size);
+  if (aux == NULL)
+    return NULL;
+  *max = new_max;
+
+  return aux;
+}
+
+Graph* game_utils_graph(Game* game) {
+  if (!game)
+    return NULL;
+  /* The links of a space already in the game may have been set since the graph was built */
+  if (game->links_version != space_get_links_version()) {
+    game->graph_stale = TRUE;
+    game->map_version = ++game_map_versions;
+  }
+  if (game->graph_stale == TRUE && game_build_graph(game) == ERROR)
+    return NULL;
+  return game->graph;
+}
+
+STATUS game_utils_names(Game* game) {
+  if (game->names_stale == TRUE && game_build_names(game) == ERROR)
+    return ERROR;
   return OK;
 }
 
+void game_utils_move(Game* game, DIRECTION dir) {
+  Id next_id = NO_ID;
+
+  /* One read of the edge of the space gives the neighbour and whether the link is opened.
+     No link counts as a closed one, so the player stays and the inspected text is kept */
+  next_id = graph_get_open_neighbour(game_utils_graph(game), player_get_location(game->player), dir);
+  if (next_id == NO_ID) {
+    game->status = ERROR;
+    return;
+  }
+
+  player_set_location(game->player, next_id);
+  strcpy(game->full_description,"\0");
+  game->status = OK;
+}
+
+int game_utils_direction(const char* word) {
+  int d;
+
+  for (d = 0; d < N_DIRECTIONS; d++) {
+    if (strcmp(word, game_dir_to_str[d]) == 0 || strcmp(word, game_short_dir_to_str[d]) == 0)
+      return d;
+  }
+
+  return -1;
+}
+
 STATUS game_set_rules_string(Game *game, const char* feedback) {
   if(game == NULL || feedback == NULL) {
     return ERROR;
@@ -227,48 +470,119 @@ STATUS game_set_rules_string(Game *game, const char* feedback) {
 
 
 STATUS game_set_space(Game* game, Space* space) {
-  int i = 0;
+  Space** spaces = NULL;
 
   if (space == NULL || game == NULL) {
     return ERROR;
   }
 
-  while ( (i < MAX_SPACES) && (game->spaces[i] != NULL)) {
-    i++;
+  spaces = (Space**) game_utils_grow(game->spaces, game->n_spaces, &game->max_spaces, sizeof(Space*));
+  if (spaces == NULL) {
+    return ERROR;
   }
+  game->spaces = spaces;
 
-  if (i >= MAX_SPACES) {
+  if (space_set_intern(space, game->strings) == ERROR) {
+    return ERROR;
+  }
+  if (space_get_id(space) != NO_ID && id_table_add(game->space_ids, space_get_id(space), game->n_spaces) == ERROR) {
     return ERROR;
   }
 
-  game->spaces[i] = space;
+  game->spaces[game->n_spaces++] = space;
+  game->spaces[game->n_spaces] = NULL;
+  game->graph_stale = TRUE;
+  game->map_version = ++game_map_versions;
 
   return OK;
 }
 
 STATUS game_set_link(Game* game, Link* link) {
-  int i = 0;
+  Link** links = NULL;
 
   if (game==NULL || link == NULL) {
     return ERROR;
   }
 
-  while ( (i < MAX_LINKS) && (game->links[i] != NULL)) {
-    i++;
+  links = (Link**) game_utils_grow(game->links, game->n_links, &game->max_links, sizeof(Link*));
+  if (links == NULL) {
+    return ERROR;
+  }
+  game->links = links;
+
+  if (link_set_intern(link, game->strings) == ERROR) {
+    return ERROR;
+  }
+  if (link_get_id(link) != NO_ID && id_table_add(game->link_ids, link_get_id(link), game->n_links) == ERROR) {
+    return ERROR;
+  }
+
+  game->links[game->n_links++] = link;
+  game->links[game->n_links] = NULL;
+  game->graph_stale = TRUE;
+  game->names_stale = TRUE;
+  game->map_version = ++game_map_versions;
+
+  return OK;
+}
+
+STATUS game_set_link_status(Game* game, Id id, LINKSTATUS status) {
+  if (!game) {
+    return ERROR;
   }
 
-  if (i >= MAX_LINKS) {
+  if (link_set_status(game_get_link(game, id), status) == ERROR) {
     return ERROR;
   }
+  game->map_version = ++game_map_versions;
+
+  return OK;
+}
 
-  game->links[i] = link;
+STATUS game_build_graph(Game* game) {
+  if (!game) {
+    return ERROR;
+  }
+  if (graph_build(game->graph, game->spaces, game->n_spaces, game->links, game->n_links) == ERROR) {
+    return ERROR;
+  }
+  game->graph_stale = FALSE;
+  game->links_version = space_get_links_version();
 
   return OK;
 }
 
+Id game_get_neighbour(Game* game, Id id, DIRECTION dir) {
+  return graph_get_neighbour(game_utils_graph(game), id, dir);
+}
+
+Id game_get_neighbour_link(Game* game, Id id, DIRECTION dir) {
+  return graph_get_link(game_utils_graph(game), id, dir);
+}
+
+LINKSTATUS game_get_neighbour_status(Game* game, Id id, DIRECTION dir) {
+  return graph_get_link_status(game_utils_graph(game), id, dir);
+}
+
+long game_get_map_version(Game* game) {
+  if (!game) {
+    return -1;
+  }
+  /* The version changes too if the links of a space changed since the graph was built */
+  game_utils_graph(game);
+  return game->map_version;
+}
+
+long game_get_descript_version(Game* game) {
+  if (!game) {
+    return -1;
+  }
+  return game->descript_version;
+}
+
 Id game_get_space_id_at(Game* game, int index) {
 
-  if (index < 0 || index >= MAX_SPACES || game==NULL) {
+  if (game==NULL || index < 0 || index >= game->n_spaces) {
     return NO_ID;
   }
 
@@ -276,23 +590,22 @@ Id game_get_space_id_at(Game* game, int index) {
 }
 
 Space* game_get_space(Game* game, Id id) {
-  int i = 0;
+  int i;
 
-  if (id == NO_ID || game==NULL) {
+  if (id == NO_ID || game == NULL) {
     return NULL;
   }
 
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++) {
-    if (id == space_get_id(game->spaces[i])){
-      return game->spaces[i];
-    }
+  i = id_table_find(game->space_ids, id);
+  if (i == NO_ENTRY) {
+    return NULL;
   }
 
-  return NULL;
+  return game->spaces[i];
 }
 
 Space* game_get_space_by_index(Game* game, int index) {
-  if (!game || index<0 || index>MAX_SPACES || game == NULL) {
+  if (!game || index<0 || index>=game->n_spaces) {
     return NULL;
   }
 
@@ -300,23 +613,22 @@ Space* game_get_space_by_index(Game* game, int index) {
 }
 
 Link* game_get_link(Game* game, Id id) {
-  int i = 0;
+  int i;
 
   if (id == NO_ID || game == NULL) {
     return NULL;
   }
 
-  for (i = 0; i < MAX_LINKS && game->links[i] != NULL; i++) {
-    if (id == link_get_id(game->links[i])) {
-      return game->links[i];
-    }
+  i = id_table_find(game->link_ids, id);
+  if (i == NO_ENTRY) {
+    return NULL;
   }
 
-  return NULL;
+  return game->links[i];
 }
 
 Link* game_get_link_by_index(Game* game, int index) {
-  if (!game || index<0 || index>MAX_LINKS || game == NULL) {
+  if (!game || index<0 || index>=game->n_links) {
     return NULL;
   }
 
@@ -325,7 +637,7 @@ Link* game_get_link_by_index(Game* game, int index) {
 
 STATUS game_set_player(Game* game, Player* player) {
 
-  if (game==NULL || player==NULL) {
+  if (game==NULL || player==NULL || player_set_intern(player, game->strings) == ERROR) {
     return ERROR;
   }
 
@@ -335,21 +647,28 @@ STATUS game_set_player(Game* game, Player* player) {
 }
 
 STATUS game_set_object(Game* game, Object* object) {
-  int i = 0;
+  Object** objects = NULL;
 
   if (game==NULL || object == NULL) {
     return ERROR;
   }
 
-  while ( (i < MAX_OBJECTS) && (game->objects[i] != NULL)) {
-    i++;
+  objects = (Object**) game_utils_grow(game->objects, game->n_objects, &game->max_objects, sizeof(Object*));
+  if (objects == NULL) {
+    return ERROR;
   }
+  game->objects = objects;
 
-  if (i >= MAX_OBJECTS) {
+  if (object_set_intern(object, game->strings) == ERROR || object_set_table(object, game->object_table) == ERROR) {
+    return ERROR;
+  }
+  if (object_get_id(object) != NO_ID && id_table_add(game->object_ids, object_get_id(object), game->n_objects) == ERROR) {
     return ERROR;
   }
 
-  game->objects[i] = object;
+  game->objects[game->n_objects++] = object;
+  game->objects[game->n_objects] = NULL;
+  game->names_stale = TRUE;
 
   return OK;
 }
@@ -362,23 +681,22 @@ Player* game_get_player(Game* game) {
 }
 
 Object* game_get_object(Game* game, Id id) {
-  int i = 0;
+  int i;
 
   if (id == NO_ID || game == NULL) {
     return NULL;
   }
 
-  for (i = 0; i < MAX_OBJECTS && game->objects[i] != NULL; i++) {
-    if (id == object_get_id(game->objects[i])) {
-      return game->objects[i];
-    }
+  i = id_table_find(game->object_ids, id);
+  if (i == NO_ENTRY) {
+    return NULL;
   }
 
-  return NULL;
+  return game->objects[i];
 }
 
 Object* game_get_object_by_index(Game* game, int index) {
-  if (!game || index<0 || index>MAX_OBJECTS|| game == NULL) {
+  if (!game || index<0 || index>=game->n_objects) {
     return NULL;
   }
 
@@ -386,88 +704,231 @@ Object* game_get_object_by_index(Game* game, int index) {
 }
 
 Object* game_get_object_by_name(Game* game, char* name) {
-  int i = 0;
-  if (!game || !name) {
+  Object *object = NULL;
+  int i;
+
+  if (!game || !name || game_utils_names(game) == ERROR) {
     return NULL;
   }
 
-  for (i = 0; i < MAX_OBJECTS && game->objects[i] != NULL; i++) {
-    if (strcmp(object_get_name(game->objects[i]), name)==0) {
-      return game->objects[i];
-    }
+  object = (Object*) name_index_find(game->object_names, name);
+  if (object || !name[0]) {
+    return object;
   }
 
-  return NULL;
+  /* Else the only object whose name begins like that */
+  i = trie_find_prefix(game->object_words, name);
+  return (i == NO_MATCH) ? NULL : game->objects[i];
 }
 
 Link* game_get_link_by_name(Game* game, char* name) {
-  int i = 0;
-  if (!game || !name) {
+  Link *link = NULL;
+  int i;
+
+  if (!game || !name || game_utils_names(game) == ERROR) {
     return NULL;
   }
 
-  for (i = 0; i < MAX_LINKS && game->links[i] != NULL; i++) {
-    if (strcmp(link_get_name(game->links[i]), name)==0) {
-      return game->links[i];
-    }
+  link = (Link*) name_index_find(game->link_names, name);
+  if (link || !name[0]) {
+    return link;
   }
 
-  return NULL;
+  i = trie_find_prefix(game->link_words, name);
+  return (i == NO_MATCH) ? NULL : game->links[i];
 }
 
-Id game_get_object_location(Game* game, Id id) {
-  int i=0, j=0;
-  if (!game || !(game->objects) || !(game->spaces))
-    return NO_ID;
-  for (i=0; game->spaces[i]!=NULL && i<=MAX_SPACES; i++) {
-    for (j=0; space_get_object(game->spaces[i], j)!=NO_ID && j<MAX_ID; j++) {
-      if (space_get_object(game->spaces[i], j)==id) {
-        return game_get_space_id_at(game, i);
-      }
+int game_complete_name(Game* game, const char* prefix, const char** names, int max) {
+  int n_objects;
+
+  if (!game || !prefix || max < 0 || (max > 0 && !names) || game_utils_names(game) == ERROR) {
+    return -1;
+  }
+
+  /* The objects go first, the links fill the room left */
+  n_objects = trie_complete(game->object_words, prefix, names, max);
+  if (n_objects < max) {
+    return n_objects + trie_complete(game->link_words, prefix, names + n_objects, max - n_objects);
+  }
+
+  return n_objects + trie_complete(game->link_words, prefix, NULL, 0);
+}
+
+STATUS game_build_names(Game* game) {
+  int i;
+
+  if (!game || name_index_clear(game->object_names) == ERROR || name_index_clear(game->link_names) == ERROR ||
+      trie_clear(game->object_words) == ERROR || trie_clear(game->link_words) == ERROR) {
+    return ERROR;
+  }
+
+  /* The names live in the table of strings of the game, so they are not copied */
+  for (i = 0; i < game->n_objects; i++) {
+    if (name_index_add(game->object_names, object_get_name(game->objects[i]), game->objects[i]) == ERROR ||
+        trie_add(game->object_words, object_get_name(game->objects[i]), i) == ERROR) {
+      return ERROR;
     }
   }
-  if (game->spaces[i]==NULL)
-    return NO_ID;
-  return game_get_space_id_at(game, i);
+  for (i = 0; i < game->n_links; i++) {
+    if (name_index_add(game->link_names, link_get_name(game->links[i]), game->links[i]) == ERROR ||
+        trie_add(game->link_words, link_get_name(game->links[i]), i) == ERROR) {
+      return ERROR;
+    }
+  }
+  game->names_stale = FALSE;
+
+  return OK;
 }
 
-int game_get_number_of_objects(Game* game) {
-  int i=0;
+STATUS game_set_ignore_case(Game* game, BOOL ignore_case) {
+  Name_index *objects = NULL, *links = NULL;
+  Trie *object_words = NULL, *link_words = NULL;
 
-  if(!game)
-    return -1;
+  if (!game) {
+    return ERROR;
+  }
 
-  while(game->objects[i]!=NULL) {
-    i++;
+  objects = name_index_create(ignore_case);
+  links = name_index_create(ignore_case);
+  object_words = trie_create(ignore_case);
+  link_words = trie_create(ignore_case);
+  if (!objects || !links || !object_words || !link_words) {
+    name_index_destroy(objects);
+    name_index_destroy(links);
+    trie_destroy(object_words);
+    trie_destroy(link_words);
+    return ERROR;
   }
+  name_index_destroy(game->object_names);
+  name_index_destroy(game->link_names);
+  trie_destroy(game->object_words);
+  trie_destroy(game->link_words);
+  game->object_names = objects;
+  game->link_names = links;
+  game->object_words = object_words;
+  game->link_words = link_words;
+  game->ignore_case = ignore_case;
+  game->names_stale = TRUE;
 
-  return i;
+  return OK;
 }
 
-int game_get_number_of_spaces(Game* game) {
-  int i=0;
+Id game_get_object_location(Game* game, Id id) {
+  Id location;
+
+  location = game_object_location_management(game, id);
+  if (location == IN_PLAYER)
+    return NO_ID;
+  return location;
+}
+
+STATUS game_move_object(Game* game, Id id, Id location) {
+  Id from;
+  int row;
+  STATUS st = OK;
 
+  if (!game)
+    return ERROR;
+  row = object_table_get_row(game->object_table, id);
+  if (row == NO_ROW)
+    return ERROR;
+  from = object_table_get_location(game->object_table, row);
+  if (from == location)
+    return OK;
+
+  /* The object goes in before it leaves, so if it does not fit it stays where it was */
+  if (location == IN_PLAYER)
+    st = player_set_object(game->player, id);
+  else if (location != NO_ID)
+    st = space_set_object(game_get_space(game, location), id);
+  if (st == ERROR)
+    return ERROR;
+
+  if (from == IN_PLAYER)
+    player_del_object(game->player, id);
+  else if (from != NO_ID)
+    space_del_object(game_get_space(game, from), id);
+  object_table_set_location(game->object_table, row, location);
+  game->descript_version = ++game_descript_versions;
+
+  return OK;
+}
+
+int game_find_objects(Game* game, int with, int without, Set* within, Set* found) {
+  if (!game)
+    return -1;
+  return object_table_find(game->object_table, with, without, within, found);
+}
+
+BOOL game_space_is_lit(Game* game, Id id) {
+  Space* space = NULL;
+  Set* lights = NULL;
+  BOOL lit = FALSE;
+  int i, n;
+
+  space = game_get_space(game, id);
+  if (!space)
+    return FALSE;
+  if (space_get_lighting(space) == TRUE)
+    return TRUE;
+
+  /* Only the few objects giving light are looked for, wherever they are */
+  lights = set_create_type(NULL, BIT_SET);
+  n = game_find_objects(game, OBJECT_ILLUMINATE | OBJECT_TURNEDON, 0, NULL, lights);
+  for (i=0; i<n && lit==FALSE; i++) {
+    if (space_has_object(space, set_get(lights, i)) == TRUE)
+      lit = TRUE;
+    else if (player_get_location(game->player) == id && player_has_object(game->player, set_get(lights, i)) == TRUE)
+      lit = TRUE;
+  }
+  set_destroy(lights);
+
+  return lit;
+}
+
+int game_get_number_of_objects(Game* game) {
   if(!game)
     return -1;
 
-  while(game->spaces[i]!=NULL) {
-    i++;
-  }
+  return game->n_objects;
+}
+
+int game_get_number_of_spaces(Game* game) {
+  if(!game)
+    return -1;
 
-  return i;
+  return game->n_spaces;
 }
 
 int game_get_number_of_links(Game* game) {
-  int i=0;
-
   if(!game)
     return -1;
 
-  while(game->links[i]!=NULL) {
-    i++;
-  }
+  return game->n_links;
+}
+
+Space** game_get_spaces(Game* game, int* n) {
+  if(!game || !n)
+    return NULL;
+
+  *n = game->n_spaces;
+  return game->spaces;
+}
+
+Object** game_get_objects(Game* game, int* n) {
+  if(!game || !n)
+    return NULL;
+
+  *n = game->n_objects;
+  return game->objects;
+}
 
-  return i;
+Link** game_get_links(Game* game, int* n) {
+  if(!game || !n)
+    return NULL;
+
+  *n = game->n_links;
+  return game->links;
 }
 
 STATUS game_get_status(Game* game) {
@@ -477,14 +938,29 @@ STATUS game_get_status(Game* game) {
 }
 
 STATUS game_update(Game* game, T_Command cmd) {
+  int die_value;
+
   if(game == NULL) {
     return ERROR;
   }
+  die_value = die_last_value(game->die);
   strcpy(game->description, "\0");
   die_set_default_value(game->die);
   game->last_cmd = game->new_cmd;
   game->new_cmd = cmd;
   (*game_callback_fn_list[cmd])(game);
+
+  /* Commands that move objects, inspect or move the player (which clears the inspected text) */
+  switch (cmd) {
+    case MOVE: case NEXT: case BACK: case RIGHT: case LEFT:
+    case TAKE: case DROP: case INSPECT: case LOAD:
+      game->descript_version = ++game_descript_versions;
+      break;
+    default:
+      if (die_value != die_last_value(game->die))
+        game->descript_version = ++game_descript_versions;
+      break;
+  }
   return OK;
 }
 
@@ -503,15 +979,14 @@ void game_print_data(Game* game) {
   printf("\n\n-------------\n\n");
 
   printf("=> Spaces: \n");
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++) {
+  for (i = 0; i < game->n_spaces; i++) {
     space_print(game->spaces[i]);
   }
 
   printf("=> Object location: \n");
-  for (i = 0; i < MAX_OBJECTS && game->objects[i] != NULL; i++) {
+  for (i = 0; i < game->n_objects; i++) {
     object_print(game->objects[i]);
   }
-  object_print(game->objects[i]);
   printf("=> Player location: \n");
   player_print(game->player);
   printf("prompt:> ");
@@ -561,10 +1036,7 @@ Id game_object_location_management(Game* game, Id id) {
   if(!game || id==NO_ID) {
     return NO_ID;
   }
-  if(player_has_object(game_get_player(game),id)==TRUE) {
-    return -2;
-  }
-  return game_get_object_location(game, id);
+  return object_table_get_location(game->object_table, object_table_get_row(game->object_table, id));
 }
 
 
@@ -595,265 +1067,34 @@ void game_callback_exit(Game* game) {
 }
 
 void game_callback_move(Game* game) {
-  int i = 0;
-  Id current_id = NO_ID;
-  Id space_id = NO_ID;
   char input[CMD_LENGTH]="";
+  int dir;
 
   scanf("%s", input);
 
-  space_id = player_get_location(game->player);
-  if (NO_ID == space_id) {
+  dir = game_utils_direction(input);
+  if (dir < 0) {
     game->status = ERROR;
     return;
   }
 
-  if(strcmp(input,"north")==0 || strcmp(input,"n")==0){
-    if(link_get_status(game_get_link(game,space_get_north(game_get_space(game, space_id))))==CLOSED){
-      game->status = ERROR;
-      return;
-    }
-    for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++) {
-      current_id = space_get_id(game->spaces[i]);
-      if (current_id == space_id) {
-        current_id = link_get_space(game_get_link(game,space_get_north(game->spaces[i])), space_get_id(game->spaces[i]));
-        if (current_id != NO_ID) {
-          player_set_location(game->player, current_id);
-        }
-        strcpy(game->full_description,"\0");
-        game->status = OK;
-        return;
-      }
-    }
-  }
-
-
-  if(strcmp(input,"south")==0 || strcmp(input,"s")==0){
-    if(link_get_status(game_get_link(game,space_get_south(game_get_space(game, space_id))))==CLOSED){
-      game->status = ERROR;
-      return;
-    }
-    for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++) {
-      current_id = space_get_id(game->spaces[i]);
-      if (current_id == space_id) {
-        current_id = link_get_space(game_get_link(game,space_get_south(game->spaces[i])), space_get_id(game->spaces[i]));
-        if (current_id != NO_ID) {
-          player_set_location(game->player, current_id);
-        }
-        strcpy(game->full_description,"\0");
-        game->status = OK;
-        return;
-      }
-    }
-  }
-
-
-  if(strcmp(input,"east")==0 || strcmp(input,"e")==0){
-    if(link_get_status(game_get_link(game,space_get_east(game_get_space(game, space_id))))==CLOSED){
-      game->status = ERROR;
-      return;
-    }
-    for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++) {
-      current_id = space_get_id(game->spaces[i]);
-      if (current_id == space_id) {
-        current_id = link_get_space(game_get_link(game,space_get_east(game->spaces[i])), space_get_id(game->spaces[i]));
-        if (current_id != NO_ID) {
-          player_set_location(game->player, current_id);
-        }
-        strcpy(game->full_description,"\0");
-        game->status = OK;
-        return;
-      }
-    }
-  }
-
-
-  if(strcmp(input,"west")==0 || strcmp(input,"w")==0){
-    if(link_get_status(game_get_link(game,space_get_west(game_get_space(game, space_id))))==CLOSED){
-      game->status = ERROR;
-      return;
-    }
-    for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++) {
-      current_id = space_get_id(game->spaces[i]);
-      if (current_id == space_id) {
-        current_id = link_get_space(game_get_link(game,space_get_west(game->spaces[i])), space_get_id(game->spaces[i]));
-        if (current_id != NO_ID) {
-          player_set_location(game->player, current_id);
-        }
-        strcpy(game->full_description,"\0");
-        game->status = OK;
-        return;
-      }
-    }
-  }
-
-
-
-
-
-  if(strcmp(input,"up")==0 || strcmp(input,"u")==0){
-    if(link_get_status(game_get_link(game,space_get_up(game_get_space(game, space_id))))==CLOSED){
-      game->status = ERROR;
-      return;
-    }
-    for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++) {
-      current_id = space_get_id(game->spaces[i]);
-      if (current_id == space_id) {
-        current_id = link_get_space(game_get_link(game,space_get_up(game->spaces[i])), space_get_id(game->spaces[i]));
-        if (current_id != NO_ID) {
-          player_set_location(game->player, current_id);
-        }
-        strcpy(game->full_description,"\0");
-        game->status = OK;
-        return;
-      }
-    }
-  }
-
-
-
-  if(strcmp(input,"down")==0 || strcmp(input,"d")==0){
-    if(link_get_status(game_get_link(game,space_get_down(game_get_space(game, space_id))))==CLOSED){
-      game->status = ERROR;
-      return;
-    }
-    for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++) {
-      current_id = space_get_id(game->spaces[i]);
-      if (current_id == space_id) {
-        current_id = link_get_space(game_get_link(game,space_get_down(game->spaces[i])), space_get_id(game->spaces[i]));
-        if (current_id != NO_ID) {
-          player_set_location(game->player, current_id);
-        }
-        strcpy(game->full_description,"\0");
-        game->status = OK;
-        return;
-      }
-    }
-  }
+  game_utils_move(game, (DIRECTION) dir);
 }
 
 void game_callback_next(Game* game) {
-  int i = 0;
-  Id current_id = NO_ID;
-  Id space_id = NO_ID;
-
-  space_id = player_get_location(game->player);
-
-  if(link_get_status(game_get_link(game,space_get_south(game_get_space(game, space_id))))==CLOSED){
-    game->status = ERROR;
-    return;
-  }
-
-  if (space_id == NO_ID) {
-    game->status = ERROR;
-    return;
-  }
-
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++) {
-    current_id = space_get_id(game->spaces[i]);
-    if (current_id == space_id) {
-      current_id = link_get_space(game_get_link(game,space_get_south(game->spaces[i])), space_get_id(game->spaces[i]));
-      if (current_id != NO_ID) {
-        player_set_location(game->player, current_id);
-      }
-      strcpy(game->full_description,"\0");
-      game->status = OK;
-      return;
-    }
-  }
+  game_utils_move(game, S);
 }
 
 void game_callback_back(Game* game) {
-  int i = 0;
-  Id current_id = NO_ID;
-  Id space_id = NO_ID;
-
-  space_id = player_get_location(game->player);
-
-  if(link_get_status(game_get_link(game,space_get_north(game_get_space(game, space_id))))==CLOSED){
-    game->status = ERROR;
-    return;
-  }
-
-  if (NO_ID == space_id) {
-    game->status = ERROR;
-    return;
-  }
-
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++) {
-    current_id = space_get_id(game->spaces[i]);
-    if (current_id == space_id) {
-      current_id = link_get_space(game_get_link(game,space_get_north(game->spaces[i])), space_get_id(game->spaces[i]));
-      if (current_id != NO_ID) {
-        player_set_location(game->player, current_id);
-      }
-      strcpy(game->full_description,"\0");
-      game->status = OK;
-      return;
-    }
-  }
+  game_utils_move(game, N);
 }
 
 void game_callback_right(Game* game) {
-  int i = 0;
-  Id current_id = NO_ID;
-  Id space_id = NO_ID;
-
-  space_id = player_get_location(game->player);
-
-  if(link_get_status(game_get_link(game,space_get_west(game_get_space(game, space_id))))==CLOSED){
-    game->status = ERROR;
-    return;
-  }
-
-  if (NO_ID == space_id) {
-    game->status = ERROR;
-    return;
-  }
-
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++) {
-    current_id = space_get_id(game->spaces[i]);
-    if (current_id == space_id) {
-      current_id = link_get_space(game_get_link(game,space_get_west(game->spaces[i])), space_get_id(game->spaces[i]));
-      if (current_id != NO_ID) {
-	       player_set_location(game->player, current_id);
-      }
-      strcpy(game->full_description,"\0");
-      game->status = OK;
-      return;
-    }
-  }
+  game_utils_move(game, W);
 }
 
 void game_callback_left(Game* game) {
-  int i = 0;
-  Id current_id = NO_ID;
-  Id space_id = NO_ID;
-
-  space_id = player_get_location(game->player);
-
-  if(link_get_status(game_get_link(game,space_get_east(game_get_space(game, space_id))))==CLOSED){
-    game->status = ERROR;
-    return;
-  }
-
-  if (NO_ID == space_id) {
-    game->status = ERROR;
-    return;
-  }
-
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++) {
-    current_id = space_get_id(game->spaces[i]);
-    if (current_id == space_id) {
-      current_id = link_get_space(game_get_link(game,space_get_east(game->spaces[i])), space_get_id(game->spaces[i]));
-      if (current_id != NO_ID) {
-        player_set_location(game->player, current_id);
-      }
-      strcpy(game->full_description,"\0");
-      game->status = OK;
-      return;
-    }
-  }
+  game_utils_move(game, E);
 }
 
 void game_callback_take(Game* game) {
@@ -873,13 +1114,7 @@ void game_callback_take(Game* game) {
     return;
   }
 
-  if (player_set_object(game->player, object_id)==ERROR) {
-    game->status = ERROR;
-    return;
-  }
-
-
-  if (space_del_object(game_get_space(game, game_get_object_location(game, object_id)), object_id)==ERROR) {
+  if (game_move_object(game, object_id, IN_PLAYER)==ERROR) {
     game->status = ERROR;
     return;
   }
@@ -905,13 +1140,7 @@ void game_callback_drop(Game* game) {
     return;
   }
 
-  if (space_set_object(game_get_space(game, player_get_location(game->player)), object_id)==ERROR) {
-    game->status = ERROR;
-    return;
-  }
-
-
-  if (player_del_object(game->player, object_id)==ERROR) {
+  if (game_move_object(game, object_id, player_get_location(game->player))==ERROR) {
     game->status = ERROR;
     return;
   }
@@ -947,7 +1176,7 @@ void game_callback_inspect(Game* game) {
   scanf("%s", input);
 
   if (strcmp(input,"s")==0 || strcmp(input, "space")==0){
-    if(space_get_full_description(game_get_space(game, player_get_location(game->player))) == NULL) {
+    if(game_space_is_lit(game, player_get_location(game->player)) == FALSE) {
       strncpy(game->full_description, "Not enough light to see the space", WORD_SIZE);
       game->status = ERROR;
       return;
@@ -996,6 +1225,7 @@ void game_callback_inspect(Game* game) {
 
 void game_callback_turnon(Game* game) {
   char input[CMD_LENGTH]="";
+  Object* object = NULL;
 
   scanf("%s", input);
   if(!game || !game->objects) {
@@ -1003,13 +1233,14 @@ void game_callback_turnon(Game* game) {
     return;
   }
 
-  if (player_has_object(game_get_player(game),object_get_id(game_get_object_by_name(game, input)))==FALSE) {
+  object = game_get_object_by_name(game, input);
+  if (player_has_object(game_get_player(game),object_get_id(object))==FALSE) {
     game->status = ERROR;
     return;
   }
 
-  if(object_get_illuminate(game_get_object_by_name(game, input))==TRUE) {
-    if(object_set_turnedon(game_get_object_by_name(game, input), TRUE)==ERROR) {
+  if(object_get_illuminate(object)==TRUE) {
+    if(object_set_turnedon(object, TRUE)==ERROR) {
       game->status = ERROR;
       return;
     }
@@ -1023,6 +1254,7 @@ void game_callback_turnon(Game* game) {
 
 void game_callback_turnoff(Game* game) {
   char input[CMD_LENGTH]="";
+  Object* object = NULL;
 
   scanf("%s", input);
   if(!game || !game->objects) {
@@ -1030,13 +1262,14 @@ void game_callback_turnoff(Game* game) {
     return;
   }
 
-  if (player_has_object(game_get_player(game),object_get_id(game_get_object_by_name(game, input)))==FALSE) {
+  object = game_get_object_by_name(game, input);
+  if (player_has_object(game_get_player(game),object_get_id(object))==FALSE) {
     game->status = ERROR;
     return;
   }
 
-  if(object_get_illuminate(game_get_object_by_name(game, input))==TRUE) {
-    if(object_set_turnedon(game_get_object_by_name(game, input), FALSE)==ERROR) {
+  if(object_get_illuminate(object)==TRUE) {
+    if(object_set_turnedon(object, FALSE)==ERROR) {
       game->status = ERROR;
       return;
     }
@@ -1050,6 +1283,8 @@ void game_callback_turnoff(Game* game) {
 
 void game_callback_open(Game* game) {
   char input1[CMD_LENGTH]="",input2[CMD_LENGTH]="",input3[CMD_LENGTH]="";
+  Object* object = NULL;
+  Id link_id;
 
   scanf("%s", input1);
   scanf("%s", input2);
@@ -1059,13 +1294,15 @@ void game_callback_open(Game* game) {
     game->status = ERROR;
     return;
   }
-  if(player_has_object(game_get_player(game), object_get_id(game_get_object_by_name(game,input3)))==FALSE) {
+  object = game_get_object_by_name(game, input3);
+  if(player_has_object(game_get_player(game), object_get_id(object))==FALSE) {
     game->status = ERROR;
     return;
   }
 
-  if(object_get_open(game_get_object_by_name(game, input3)) == link_get_id(game_get_link_by_name(game,input1))) {
-    if(link_set_status(game_get_link_by_name(game,input1), OPENED)==ERROR) {
+  link_id = link_get_id(game_get_link_by_name(game, input1));
+  if(object_get_open(object) == link_id) {
+    if(game_set_link_status(game, link_id, OPENED)==ERROR) {
       game->status = ERROR;
       return;
     }
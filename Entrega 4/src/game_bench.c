@@ -0,0 +1,90 @@
+/**
+ * @brief Compares looking for the spaces of a game by id with the scan it replaced
+ *
+ * @file game_bench.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "game.h"
+
+#define N_SIZES 3
+#define MIN_OPS 2000000L     /*!< Lookups timed with the table */
+#define SCAN_OPS 20000000L   /*!< Spaces the scan is let walk, so big worlds are timed with fewer lookups */
+#define FRAME_LOOKUPS 8      /*!< Lookups by id of each frame, counted playing data.dat (5 spaces and 3 objects) */
+
+/**
+ * @brief Looks for a space as game_get_space() did before, walking every space
+ */
+Space* scan_get_space(Game* game, Id id) {
+  Space* space = NULL;
+  int i;
+  for (i=0; (space = game_get_space_by_index(game, i)) != NULL; i++) {
+    if (space_get_id(space) == id)
+      return space;
+  }
+  return NULL;
+}
+
+/**
+ * @brief Seconds since start
+ */
+double elapsed(clock_t start) {
+  return (double)(clock()-start)/CLOCKS_PER_SEC;
+}
+
+/**
+ * @brief Identifier of the space i of a world, close to each other or spread
+ */
+Id space_id(int i, BOOL spread) {
+  return spread == TRUE ? 7919L*i+1 : i+1;
+}
+
+int main() {
+  int sizes[N_SIZES]={10, 1000, 100000};
+  Game *game = NULL;
+  clock_t start;
+  double t_scan, t_table;
+  long ops, scan_ops, r, found = 0;
+  int s, n, i, spread;
+
+  printf("Lookups by id in each frame: %d\n", FRAME_LOOKUPS);
+  printf("%8s %7s %14s %14s %14s %14s\n", "spaces", "ids", "scan ns", "table ns", "scan us/frame", "table us/frame");
+  for (s=0; s<N_SIZES; s++) {
+    n = sizes[s];
+    for (spread=FALSE; spread<=TRUE; spread++) {
+      game = game_create();
+      if (!game)
+        return EXIT_FAILURE;
+      for (i=0; i<n; i++) {
+        if (game_set_space(game, space_create_in(game_get_arena(game), space_id(i, spread))) == ERROR)
+          return EXIT_FAILURE;
+      }
+
+      /* The ids are looked for out of order, as the player walks */
+      scan_ops = (SCAN_OPS/n < MIN_OPS) ? SCAN_OPS/n : MIN_OPS;
+      start = clock();
+      for (r=0; r<scan_ops; r++)
+        found += scan_get_space(game, space_id((int)(r*7919L % n), spread)) != NULL;
+      t_scan = elapsed(start);
+
+      ops = MIN_OPS;
+      start = clock();
+      for (r=0; r<ops; r++)
+        found += game_get_space(game, space_id((int)(r*7919L % n), spread)) != NULL;
+      t_table = elapsed(start);
+
+      printf("%8d %7s %14.1f %14.1f %14.3f %14.3f\n", n, spread ? "spread" : "close",
+             1e9*t_scan/scan_ops, 1e9*t_table/ops, 1e6*FRAME_LOOKUPS*t_scan/scan_ops, 1e6*FRAME_LOOKUPS*t_table/ops);
+      game_destroy(game);
+    }
+  }
+  if (found == 0)
+    printf("Nothing found\n");
+
+  return EXIT_SUCCESS;
+}
@@ -27,9 +27,29 @@ int main(int argc, char *argv[]) {
   T_Command last_cmd = UNKNOWN;
   char status[WORD_SIZE + 1]="\0";
   extern char *cmd_to_str[];
+  RENDER render = TERMINAL_RENDER;
+  char *snapshot = NULL;
+  int i, j;
+
+  /* Render options (-c reports the cost of every frame, -u keeps UTF-8 text) are taken out so the rest keep their position */
+  for (i=1, j=1; i<argc; i++) {
+    if (strcmp(argv[i], "-n")==0)
+      render = NULL_RENDER;
+    else if (strcmp(argv[i], "-c")==0)
+      screen_set_stats(stderr);
+    else if (strcmp(argv[i], "-u")==0)
+      screen_set_utf8(TRUE);
+    else if (strcmp(argv[i], "-s")==0 && i+1<argc) {
+      render = SNAPSHOT_RENDER;
+      snapshot = argv[++i];
+    }
+    else
+      argv[j++] = argv[i];
+  }
+  argc = j;
 
   if (argc < 2) {
-    fprintf(stderr, "Use: %s <game_data_file>\n", argv[0]);
+    fprintf(stderr, "Use: %s <game_data_file> [-n | -s <snapshot_file>] [-c] [-u]\n", argv[0]);
     return 1;
   }
   if(argc==4 && strcmp(argv[2],"-l")==0) {
@@ -66,7 +86,7 @@ int main(int argc, char *argv[]) {
     rules=game_rules_create();
   }
 
-	if ((gengine = graphic_engine_create()) == NULL) {
+	if ((gengine = graphic_engine_create_render(render, snapshot)) == NULL) {
     fprintf(stderr, "Error while initializing graphic engine.\n");
     game_destroy(game);
     fclose(file);
@@ -95,6 +115,7 @@ int main(int argc, char *argv[]) {
   game_destroy(game);
   game_rules_destroy(rules);
 	graphic_engine_destroy(gengine);
+  command_free_words();
 
   if(resgister_flag==1) {
     fclose(file);
@@ -14,6 +14,7 @@
 #include <string.h>
 
 #include "game_management.h"
+#include "sgr.h"
 
 
 Game* game_management_create_from_file(char* filename) {
@@ -41,6 +42,10 @@ Game* game_management_create_from_file(char* filename) {
     return NULL;
   }
 
+  if (game_build_graph(game) == ERROR || game_build_names(game) == ERROR) {
+    game_destroy(game);
+    return NULL;
+  }
 
   return game;
 }
@@ -90,6 +95,8 @@ STATUS game_management_load_spaces(Game* game, char* filename) {
       for (gdescline=0; gdescline<MAX_GDESC_LINES; gdescline++) {
         toks = strtok(NULL, "|");
         strcpy(gdesc[gdescline], toks);
+        /* The art repeats its colours for almost every character */
+        sgr_minimise(gdesc[gdescline]);
       }
       toks = strtok(NULL, "|");
       strcpy(description, toks);
@@ -103,8 +110,9 @@ STATUS game_management_load_spaces(Game* game, char* filename) {
       }
       printf("|%s\n", description);
 #endif
-      space = space_create(id);
-      if (space != NULL) {
+      space = space_create_in(game_get_arena(game), id);
+      /* Added first, so its strings go straight to the table of the game */
+      if (space != NULL && game_set_space(game, space) == OK) {
         space_set_name(space, name);
         space_set_north(space, north);
         space_set_west(space, west);
@@ -118,7 +126,6 @@ STATUS game_management_load_spaces(Game* game, char* filename) {
         space_set_description(space, description);
         space_set_full_description(space, full_description);
         space_set_lighting(space,lighting);
-        game_set_space(game, space);
       }
     }
   }
@@ -166,13 +173,12 @@ STATUS game_management_load_links(Game* game, char* filename) {
 #ifdef DEBUG
       printf("Leido: %ld|%s|%ld|%ld|%ld|\n", id, name, north, south, linkstatus);
 #endif
-      link = link_create(id);
-      if (link != NULL) {
+      link = link_create_in(game_get_arena(game), id);
+      if (link != NULL && game_set_link(game, link) == OK) {
         link_set_name(link, name);
         link_set_north(link, north);
         link_set_south(link, south);
         link_set_status(link, linkstatus);
-        game_set_link(game, link);
       }
     }
   }
@@ -235,15 +241,10 @@ STATUS game_management_load_objects(Game* game, char* filename) {
 #ifdef DEBUG
       printf("Leido: %ld|%s|%ld|%s\n", id, name, location, description);
 #endif
-      object = object_create(id);
-      if (object != NULL) {
+      object = object_create_in(game_get_arena(game), id);
+      if (object != NULL && game_set_object(game, object) == OK) {
 	       object_set_name(object, name);
-         if(location == -2) {
-           player_set_object(game_get_player(game), id);
-         }
-         else {
-	       space_set_object(game_get_space(game, location), id);
-        }
+         game_move_object(game, id, location);
          object_set_movable(object, movable);
          object_set_moved(object, moved);
          object_set_hidden(object, hidden);
@@ -252,7 +253,6 @@ STATUS game_management_load_objects(Game* game, char* filename) {
          object_set_turnedon(object, turnedon);
          object_set_description(object, description);
          object_set_full_description(object, full_description);
-         game_set_object(game, object);
       }
     }
   }
@@ -300,11 +300,10 @@ STATUS game_management_load_player(Game* game, char* filename) {
 #ifdef DEBUG
       printf("Leido: %ld|%s|%ld|%ld\n", id, name, location, maxobjects);
 #endif
-      player = player_create(id, maxobjects);
-      if (player != NULL) {
+      player = player_create_in(game_get_arena(game), id, maxobjects);
+      if (player != NULL && game_set_player(game, player) == OK) {
 	       player_set_name(player, name);
          player_set_location(player,location);
-         game_set_player(game, player);
       }
     }
   }
@@ -320,7 +319,10 @@ STATUS game_management_load_player(Game* game, char* filename) {
 
 STATUS game_management_save(Game *game, char* filename) {
   FILE *f = NULL;
-  int i, j;
+  Space **spaces = NULL;
+  Link **links = NULL;
+  Object **objects = NULL;
+  int i, j, n = 0;
   Id id;
   if(!game || !filename) {
     return ERROR;
@@ -332,21 +334,24 @@ STATUS game_management_save(Game *game, char* filename) {
     return ERROR;
   }
   /* Saving spaces */
-  for(i=0; i<game_get_number_of_spaces(game);i++) {
-    fprintf(f, "#s:%ld|%s|%ld|%ld|%ld|%ld|%ld|%ld|%d|", space_get_id(game_get_space_by_index(game, i)), space_get_name(game_get_space_by_index(game, i)), space_get_north(game_get_space_by_index(game, i)), space_get_west(game_get_space_by_index(game, i)), space_get_south(game_get_space_by_index(game, i)), space_get_east(game_get_space_by_index(game, i)), space_get_up(game_get_space_by_index(game, i)), space_get_down(game_get_space_by_index(game, i)), space_get_lighting(game_get_space_by_index(game,i)));
+  spaces = game_get_spaces(game, &n);
+  for(i=0; i<n; i++) {
+    fprintf(f, "#s:%ld|%s|%ld|%ld|%ld|%ld|%ld|%ld|%d|", space_get_id(spaces[i]), space_get_name(spaces[i]), space_get_north(spaces[i]), space_get_west(spaces[i]), space_get_south(spaces[i]), space_get_east(spaces[i]), space_get_up(spaces[i]), space_get_down(spaces[i]), space_get_lighting(spaces[i]));
     for(j=1; j<=MAX_GDESC_LINES; j++) {
-      fprintf(f, "%s|", space_get_gdesc(game_get_space_by_index(game, i), j));
+      fprintf(f, "%s|", space_get_gdesc(spaces[i], j));
     }
-    fprintf(f, "%s|%s|\n", space_get_description(game_get_space_by_index(game, i)), space_get_full_description(game_get_space_by_index(game, i)));
+    fprintf(f, "%s|%s|\n", space_get_description(spaces[i]), space_get_full_description(spaces[i]));
   }
   /* Saving links */
-  for(i=0; i<game_get_number_of_links(game); i++) {
-    fprintf(f, "#l:%ld|%s|%ld|%ld|%d|\n", link_get_id(game_get_link_by_index(game, i)), link_get_name(game_get_link_by_index(game, i)), link_get_north(game_get_link_by_index(game, i)), link_get_south(game_get_link_by_index(game, i)), link_get_status(game_get_link_by_index(game, i)));
+  links = game_get_links(game, &n);
+  for(i=0; i<n; i++) {
+    fprintf(f, "#l:%ld|%s|%ld|%ld|%d|\n", link_get_id(links[i]), link_get_name(links[i]), link_get_north(links[i]), link_get_south(links[i]), link_get_status(links[i]));
   }
   /* Saving objects */
-  for(i=0; i<game_get_number_of_objects(game); i++) {
-    id=object_get_id(game_get_object_by_index(game, i));
-    fprintf(f, "#o:%ld|%s|%ld|%d|%d|%d|%ld|%d|%d|%s|%s|\n", id, object_get_name(game_get_object_by_index(game, i)),game_object_location_management(game, id) ,object_get_movable(game_get_object_by_index(game, i)), object_get_moved(game_get_object_by_index(game,i)), object_get_hidden(game_get_object_by_index(game, i)), object_get_open(game_get_object_by_index(game, i)), object_get_illuminate(game_get_object_by_index(game, i)), object_get_turnedon(game_get_object_by_index(game, i)), object_get_description(game_get_object_by_index(game,i)), object_get_full_description(game_get_object_by_index(game,i)));
+  objects = game_get_objects(game, &n);
+  for(i=0; i<n; i++) {
+    id=object_get_id(objects[i]);
+    fprintf(f, "#o:%ld|%s|%ld|%d|%d|%d|%ld|%d|%d|%s|%s|\n", id, object_get_name(objects[i]),game_object_location_management(game, id) ,object_get_movable(objects[i]), object_get_moved(objects[i]), object_get_hidden(objects[i]), object_get_open(objects[i]), object_get_illuminate(objects[i]), object_get_turnedon(objects[i]), object_get_description(objects[i]), object_get_full_description(objects[i]));
   }
   /* Saving player */
   fprintf(f, "#p:1|%s|%ld|%d|", player_get_name(game_get_player(game)), player_get_location(game_get_player(game)), player_get_maxobjects(game_get_player(game)));
@@ -368,13 +373,16 @@ STATUS game_management_load(Game *game, char *filename) {
     return ERROR;
   }
 
-  /*Quiza esto este mal de cara al VALGRIND*/
-  if(game_destroy(game)==ERROR) {
+  fclose(f);
+
+  /* The game is emptied and filled again, so the pointer of the caller stays valid */
+  if(game_reset(game)==ERROR) {
     return ERROR;
   }
 
-  game=game_management_create_from_file(filename);
-  if(game==NULL) {
+  if(game_management_load_spaces(game, filename) == ERROR || game_management_load_links(game, filename) == ERROR ||
+     game_management_load_player(game, filename) == ERROR || game_management_load_objects(game, filename) == ERROR ||
+     game_build_graph(game) == ERROR || game_build_names(game) == ERROR) {
     return ERROR;
   }
   if(game_set_status(game, OK)==ERROR) {
@@ -118,7 +118,7 @@ STATUS game_rules_random(Game* game, Game_rules* rules) {
       if (random == NO_ID) {
         return ERROR;
       }
-      link_set_status(game_get_link(game,random),OPENED);
+      game_set_link_status(game, random, OPENED);
 
       sprintf(feedback, "El enlace %d se ha abierto", random);
     }
@@ -129,7 +129,7 @@ STATUS game_rules_random(Game* game, Game_rules* rules) {
       if (random == NO_ID) {
         return ERROR;
       }
-      link_set_status(game_get_link(game,random),CLOSED);
+      game_set_link_status(game, random, CLOSED);
 
       sprintf(feedback, "El enlace %d se ha cerrado", random);
     }
@@ -143,7 +143,7 @@ STATUS game_rules_random(Game* game, Game_rules* rules) {
       die_roll(rules->space);
       random2 = die_last_value(rules->space);
 
-      space_set_object(game_get_space(game,random2), random);
+      game_move_object(game, random, random2);
 
       sprintf(feedback, "El objeto %d se ha movido a la casilla %d", random,random2);
     }
@@ -14,7 +14,7 @@
 #include <string.h>
 #include "game_test.h"
 
-#define MAX_TESTS 36
+#define MAX_TESTS 55
 
 /**
  * @brief Main function to test inventory module.
@@ -96,6 +96,32 @@ int main(int argc, char** argv) {
     if (all || test == 35) test1_game_set_status();
     if (all || test == 36) test2_game_set_status();
 
+    if (all || test == 37) test4_game_set_space();
+    if (all || test == 38) test4_game_set_object();
+
+    if (all || test == 39) test1_game_space_is_lit();
+    if (all || test == 40) test1_game_find_objects();
+
+    if (all || test == 41) test1_game_move_object();
+    if (all || test == 42) test2_game_move_object();
+    if (all || test == 43) test3_game_move_object();
+
+    if (all || test == 44) test1_game_get_object_by_name();
+    if (all || test == 45) test1_game_get_link_by_name();
+    if (all || test == 46) test1_game_set_ignore_case();
+
+    if (all || test == 47) test1_game_get_spaces();
+    if (all || test == 48) test1_game_get_objects();
+    if (all || test == 49) test1_game_get_links();
+
+    if (all || test == 50) test2_game_get_object_by_name();
+    if (all || test == 51) test2_game_get_link_by_name();
+    if (all || test == 52) test1_game_complete_name();
+
+    if (all || test == 53) test3_game_update();
+    if (all || test == 54) test4_game_update();
+    if (all || test == 55) test5_game_update();
+
     PRINT_PASSED_PERCENTAGE;
 
     return EXIT_SUCCESS;
@@ -120,6 +146,70 @@ void test2_game_update() {
   PRINT_TEST_RESULT(game_update(game,BACK)==OK);
 }
 
+void test3_game_update() {
+  Game *game = NULL;
+  Player *player = NULL;
+  game=game_create();
+  game_set_space(game, space_create(1));
+  player=player_create(1, 1);
+  player_set_location(player, 1);
+  game_set_player(game, player);
+  strcpy(game_get_full_description(game), "A brass key");
+  /* No link to go through: the player stays and the inspected text is kept */
+  game_update(game, NEXT);
+  PRINT_TEST_RESULT(game_get_status(game)==ERROR && player_get_location(player)==1 && !strcmp(game_get_full_description(game), "A brass key"));
+  game_destroy(game);
+}
+
+void test4_game_update() {
+  Game *game = NULL;
+  Player *player = NULL;
+  Space *space = NULL;
+  Link *link = NULL;
+  game=game_create();
+  space=space_create(1);
+  space_set_south(space, 10);
+  game_set_space(game, space);
+  game_set_space(game, space_create(2));
+  link=link_create(10);
+  link_set_north(link, 1);
+  link_set_south(link, 2);
+  link_set_status(link, OPENED);
+  game_set_link(game, link);
+  player=player_create(1, 1);
+  player_set_location(player, 1);
+  game_set_player(game, player);
+  strcpy(game_get_full_description(game), "A brass key");
+  game_update(game, NEXT);
+  PRINT_TEST_RESULT(game_get_status(game)==OK && player_get_location(player)==2 && !strcmp(game_get_full_description(game), ""));
+  game_destroy(game);
+}
+
+void test5_game_update() {
+  Game *game = NULL;
+  Player *player = NULL;
+  Link *link = NULL;
+  long version;
+  game=game_create();
+  game_set_space(game, space_create(1));
+  game_set_space(game, space_create(2));
+  link=link_create(10);
+  link_set_north(link, 1);
+  link_set_south(link, 2);
+  link_set_status(link, OPENED);
+  game_set_link(game, link);
+  player=player_create(1, 1);
+  player_set_location(player, 1);
+  game_set_player(game, player);
+  game_update(game, NEXT);
+  version=game_get_map_version(game);
+  /* The link is set once the space is already in the game, after a move built the graph */
+  space_set_south(game_get_space(game, 1), 10);
+  PRINT_TEST_RESULT(game_get_map_version(game)!=version && game_get_neighbour(game, 1, S)==2 && game_update(game, NEXT)==OK &&
+                    game_get_status(game)==OK && player_get_location(player)==2);
+  game_destroy(game);
+}
+
 void test1_game_get_space() {
   Game *game = NULL;
   Space *space;
@@ -308,6 +398,229 @@ void test3_game_set_space() {
   PRINT_TEST_RESULT(game_set_space(game,space)==ERROR);
 }
 
+void test4_game_set_space() {
+  Game *game=NULL;
+  STATUS st=OK;
+  int i;
+  game=game_create();
+
+  /* Far more spaces than the game used to have room for */
+  for (i=0; i<5000 && st==OK; i++) {
+    st=game_set_space(game, space_create_in(game_get_arena(game), i+1));
+  }
+  PRINT_TEST_RESULT(st==OK && game_get_number_of_spaces(game)==5000 && space_get_id(game_get_space_by_index(game, 4999))==5000 && game_get_space_by_index(game, 5000)==NULL && game_get_space(game, 121)!=NULL);
+  game_destroy(game);
+}
+
+void test4_game_set_object() {
+  Game *game=NULL;
+  STATUS st=OK;
+  int i;
+  game=game_create();
+
+  for (i=0; i<500 && st==OK; i++) {
+    st=game_set_object(game, object_create(i+1));
+  }
+  game_reset(game);
+  st=game_set_object(game, object_create(1));
+  PRINT_TEST_RESULT(st==OK && game_get_number_of_objects(game)==1 && game_get_object_by_index(game, 1)==NULL);
+  game_destroy(game);
+}
+
+void test1_game_space_is_lit() {
+  Game *game=NULL;
+  Object *lamp=NULL;
+  BOOL before, after;
+  game=game_create();
+  game_set_space(game, space_create(1));
+  lamp=object_create(5);
+  game_set_object(game, lamp);
+  object_set_illuminate(lamp, TRUE);
+  game_move_object(game, 5, 1);
+
+  before=game_space_is_lit(game, 1);
+  object_set_turnedon(lamp, TRUE);
+  after=game_space_is_lit(game, 1);
+  PRINT_TEST_RESULT(before==FALSE && after==TRUE);
+  game_destroy(game);
+}
+
+void test1_game_find_objects() {
+  Game *game=NULL;
+  Object *object=NULL;
+  Set *found=NULL;
+  int i;
+  game=game_create();
+  found=set_create();
+  for (i=1; i<=6; i++) {
+    object=object_create(i);
+    /* Flags set before the object is added are kept */
+    if (i%2==0) object_set_hidden(object, TRUE);
+    game_set_object(game, object);
+  }
+
+  PRINT_TEST_RESULT(game_find_objects(game, OBJECT_HIDDEN, 0, NULL, found)==3 && set_has_id(found, 4)==TRUE && set_has_id(found, 3)==FALSE);
+  set_destroy(found);
+  game_destroy(game);
+}
+
+void test1_game_move_object() {
+  Game *game=NULL;
+  game=game_create();
+  game_set_space(game, space_create(1));
+  game_set_space(game, space_create(2));
+  game_set_object(game, object_create(5));
+
+  game_move_object(game, 5, 1);
+  game_move_object(game, 5, 2);
+  PRINT_TEST_RESULT(game_get_object_location(game, 5)==2 && space_has_object(game_get_space(game, 1), 5)==FALSE && space_has_object(game_get_space(game, 2), 5)==TRUE);
+  game_destroy(game);
+}
+
+void test2_game_move_object() {
+  Game *game=NULL;
+  game=game_create();
+  game_set_space(game, space_create(1));
+  game_set_player(game, player_create(1, 1));
+  game_set_object(game, object_create(5));
+  game_set_object(game, object_create(6));
+  game_move_object(game, 5, 1);
+  game_move_object(game, 6, IN_PLAYER);
+
+  /* The inventory is full, so the object stays in the space */
+  PRINT_TEST_RESULT(game_move_object(game, 5, IN_PLAYER)==ERROR && game_get_object_location(game, 5)==1 && game_object_location_management(game, 6)==IN_PLAYER && game_get_object_location(game, 6)==NO_ID);
+  game_destroy(game);
+}
+
+void test3_game_move_object() {
+  Game *game=NULL;
+  game=game_create();
+  game_set_space(game, space_create(1));
+  PRINT_TEST_RESULT(game_move_object(game, 5, 1)==ERROR && space_has_object(game_get_space(game, 1), 5)==FALSE);
+  game_destroy(game);
+}
+
+void test1_game_get_object_by_name() {
+  Game *game=NULL;
+  Object *object=NULL;
+  game=game_create();
+  game_set_object(game, object_create(5));
+  object_set_name(game_get_object(game, 5), "key");
+  game_get_object_by_name(game, "key");
+
+  /* Objects added after a lookup are indexed too, the first with a name keeps it */
+  object=object_create(6);
+  game_set_object(game, object);
+  object_set_name(object, "lantern");
+  game_set_object(game, object_create(7));
+  object_set_name(game_get_object(game, 7), "key");
+  PRINT_TEST_RESULT(game_get_object_by_name(game, "lantern")==object && object_get_id(game_get_object_by_name(game, "key"))==5 && game_get_object_by_name(game, "door")==NULL);
+  game_destroy(game);
+}
+
+void test1_game_get_link_by_name() {
+  Game *game=NULL;
+  Link *link=NULL;
+  game=game_create();
+  link=link_create(1);
+  game_set_link(game, link);
+  link_set_name(link, "door");
+  PRINT_TEST_RESULT(game_get_link_by_name(game, "door")==link && game_get_link_by_name(game, "Door")==NULL);
+  game_destroy(game);
+}
+
+void test2_game_get_object_by_name() {
+  Game *game=NULL;
+  game=game_create();
+  game_set_object(game, object_create(5));
+  object_set_name(game_get_object(game, 5), "lantern");
+  game_set_object(game, object_create(6));
+  object_set_name(game_get_object(game, 6), "lamp");
+  game_set_object(game, object_create(7));
+  object_set_name(game_get_object(game, 7), "key");
+  /* A beginning shared by two names is not enough */
+  PRINT_TEST_RESULT(object_get_id(game_get_object_by_name(game, "lan"))==5 && object_get_id(game_get_object_by_name(game, "k"))==7 &&
+                    game_get_object_by_name(game, "la")==NULL && game_get_object_by_name(game, "")==NULL);
+  game_destroy(game);
+}
+
+void test2_game_get_link_by_name() {
+  Game *game=NULL;
+  Link *link=NULL;
+  game=game_create();
+  link=link_create(1);
+  game_set_link(game, link);
+  link_set_name(link, "door");
+  PRINT_TEST_RESULT(game_get_link_by_name(game, "do")==link && game_get_link_by_name(game, "doors")==NULL);
+  game_destroy(game);
+}
+
+void test1_game_complete_name() {
+  Game *game=NULL;
+  Link *link=NULL;
+  const char *names[2];
+  game=game_create();
+  game_set_object(game, object_create(5));
+  object_set_name(game_get_object(game, 5), "lantern");
+  game_set_object(game, object_create(6));
+  object_set_name(game_get_object(game, 6), "lamp");
+  link=link_create(1);
+  game_set_link(game, link);
+  link_set_name(link, "ladder");
+  /* Objects in alphabetical order first, then the links if there is room */
+  PRINT_TEST_RESULT(game_complete_name(game, "la", names, 2)==3 && !strcmp(names[0], "lamp") && !strcmp(names[1], "lantern") &&
+                    game_complete_name(game, "lad", names, 2)==1 && !strcmp(names[0], "ladder") && game_complete_name(NULL, "la", names, 2)==-1);
+  game_destroy(game);
+}
+
+void test1_game_set_ignore_case() {
+  Game *game=NULL;
+  Link *link=NULL;
+  game=game_create();
+  link=link_create(1);
+  game_set_link(game, link);
+  link_set_name(link, "door");
+  game_set_object(game, object_create(5));
+  object_set_name(game_get_object(game, 5), "Key");
+  game_set_ignore_case(game, TRUE);
+  PRINT_TEST_RESULT(game_get_link_by_name(game, "DOOR")==link && object_get_id(game_get_object_by_name(game, "key"))==5);
+  game_destroy(game);
+}
+
+void test1_game_get_spaces() {
+  Game *game=NULL;
+  Space **spaces=NULL;
+  int n=-1;
+  game=game_create();
+  game_set_space(game, space_create(1));
+  game_set_space(game, space_create(2));
+  spaces=game_get_spaces(game, &n);
+  PRINT_TEST_RESULT(n==2 && space_get_id(spaces[0])==1 && space_get_id(spaces[1])==2 && n==game_get_number_of_spaces(game));
+  game_destroy(game);
+}
+
+void test1_game_get_objects() {
+  Game *game=NULL;
+  int n=-1;
+  game=game_create();
+  game_set_object(game, object_create(5));
+  game_reset(game);
+  game_get_objects(game, &n);
+  PRINT_TEST_RESULT(n==0 && game_get_objects(NULL, &n)==NULL);
+  game_destroy(game);
+}
+
+void test1_game_get_links() {
+  Game *game=NULL;
+  Link **links=NULL;
+  int n=-1;
+  game=game_create();
+  game_set_link(game, link_create(3));
+  links=game_get_links(game, &n);
+  PRINT_TEST_RESULT(n==1 && link_get_id(links[0])==3 && links[1]==NULL);
+  game_destroy(game);
+}
+
 void test1_game_set_link() {
   Game *game=NULL;
   Link *link=NULL;
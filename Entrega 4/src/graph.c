@@ -0,0 +1,312 @@
+/**
+ * @brief Defines the graph of spaces and links of a game (graph)
+ *
+ * @file graph.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "graph.h"
+#include "id_table.h"
+
+/**
+ * @brief Graph
+ *
+ * This structure defines the neighbours of every space in compressed rows: the
+ * edges of the space in row r are the ones from first[r] to first[r+1]-1.
+ */
+struct _Graph {
+  int *first;            /*!< First edge of every row, and the end of the last one */
+  int n_spaces;          /*!< Number of rows */
+  Id_table *rows;        /*!< Row of every space by its id */
+  DIRECTION *dir;        /*!< Direction of every edge */
+  Id *to;                /*!< Neighbour every edge goes to */
+  Id *link;              /*!< Link of every edge */
+  int *slot;             /*!< Slot of the status of the link of every edge */
+  int n_edges;           /*!< Number of edges */
+  LINKSTATUS *status;    /*!< Status of every link, the slots the links write to */
+  Link **links;          /*!< Links whose status is kept in the graph */
+  int n_links;           /*!< Number of links */
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Gets the link of a space in a direction.
+ * @param space pointer to the space.
+ * @param dir direction.
+ * @return identifier of the link, NO_ID if none.
+ */
+Id graph_utils_space_link(Space* space, DIRECTION dir);
+
+/**
+ * @brief Makes a table with the position of every identifier, keeping the first of repeated ones.
+ * @param ids identifiers, the key of each position.
+ * @param n number of identifiers.
+ * @return the table, NULL if ERROR.
+ */
+Id_table* graph_utils_table(Id* ids, int n);
+
+/**
+ * @brief Gets the edge of a space in a direction.
+ * @param graph pointer to the graph.
+ * @param id identifier of the space.
+ * @param dir direction.
+ * @return the edge, -1 if none.
+ */
+int graph_utils_edge(Graph* graph, Id id, DIRECTION dir);
+
+/**
+ * @brief Gives the links back their status and frees the arrays of a graph.
+ * @param graph pointer to the graph.
+ */
+void graph_utils_clear(Graph* graph);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
+Graph* graph_create() {
+  Graph *graph = NULL;
+
+  graph = (Graph *) malloc(sizeof(Graph));
+  if (!graph)
+    return NULL;
+
+  graph->first = NULL;
+  graph->n_spaces = 0;
+  graph->rows = NULL;
+  graph->dir = NULL;
+  graph->to = NULL;
+  graph->link = NULL;
+  graph->slot = NULL;
+  graph->n_edges = 0;
+  graph->status = NULL;
+  graph->links = NULL;
+  graph->n_links = 0;
+
+  return graph;
+}
+
+void graph_destroy(Graph* graph) {
+  if (!graph)
+    return;
+
+  graph_utils_clear(graph);
+  free(graph);
+}
+
+STATUS graph_build(Graph* graph, Space** spaces, int n_spaces, Link** links, int n_links) {
+  Id *ids = NULL, link;
+  Id_table *link_rows = NULL;
+  int i, j, e;
+  DIRECTION d;
+  Graph new;
+
+  if (!graph || n_spaces < 0 || n_links < 0 || (n_spaces > 0 && !spaces) || (n_links > 0 && !links))
+    return ERROR;
+
+  /* The first link with an id is the one that counts, as in game_get_link() */
+  ids = (Id *) malloc(((n_links > n_spaces ? n_links : n_spaces)+1)*sizeof(Id));
+  if (!ids)
+    return ERROR;
+  for (i=0; i<n_links; i++)
+    ids[i] = link_get_id(links[i]);
+  link_rows = graph_utils_table(ids, n_links);
+
+  /* Edges are counted first so the rows take just what they need */
+  new.n_edges = 0;
+  for (i=0; link_rows && i<n_spaces; i++) {
+    for (d=N; d<N_DIRECTIONS; d++) {
+      if (id_table_find(link_rows, graph_utils_space_link(spaces[i], d)) != NO_ENTRY)
+        new.n_edges++;
+    }
+  }
+
+  for (i=0; i<n_spaces; i++)
+    ids[i] = space_get_id(spaces[i]);
+  new.rows = graph_utils_table(ids, n_spaces);
+  free(ids);
+  new.first = (int *) malloc((n_spaces+1)*sizeof(int));
+  new.dir = (DIRECTION *) malloc((new.n_edges+1)*sizeof(DIRECTION));
+  new.to = (Id *) malloc((new.n_edges+1)*sizeof(Id));
+  new.link = (Id *) malloc((new.n_edges+1)*sizeof(Id));
+  new.slot = (int *) malloc((new.n_edges+1)*sizeof(int));
+  new.status = (LINKSTATUS *) malloc((n_links+1)*sizeof(LINKSTATUS));
+  new.links = (Link **) malloc((n_links+1)*sizeof(Link *));
+  if (!link_rows || !new.rows || !new.first || !new.dir || !new.to || !new.link || !new.slot || !new.status || !new.links) {
+    id_table_destroy(link_rows);
+    new.n_spaces = new.n_links = 0;
+    graph_utils_clear(&new);
+    return ERROR;
+  }
+
+  for (i=0, e=0; i<n_spaces; i++) {
+    new.first[i] = e;
+    for (d=N; d<N_DIRECTIONS; d++) {
+      link = graph_utils_space_link(spaces[i], d);
+      j = id_table_find(link_rows, link);
+      if (j == NO_ENTRY)
+        continue;
+      new.dir[e] = d;
+      new.to[e] = link_get_space(links[j], space_get_id(spaces[i]));
+      new.link[e] = link;
+      new.slot[e] = j;
+      e++;
+    }
+  }
+  new.first[n_spaces] = e;
+  new.n_spaces = n_spaces;
+  id_table_destroy(link_rows);
+
+  /* The links leave the old slots before they are freed */
+  graph_utils_clear(graph);
+  for (i=0; i<n_links; i++) {
+    new.links[i] = links[i];
+    link_set_status_slot(links[i], &new.status[i]);
+  }
+  new.n_links = n_links;
+  *graph = new;
+
+  return OK;
+}
+
+Id graph_get_neighbour(Graph* graph, Id id, DIRECTION dir) {
+  int e = graph_utils_edge(graph, id, dir);
+
+  if (e < 0)
+    return NO_ID;
+  return graph->to[e];
+}
+
+Id graph_get_link(Graph* graph, Id id, DIRECTION dir) {
+  int e = graph_utils_edge(graph, id, dir);
+
+  if (e < 0)
+    return NO_ID;
+  return graph->link[e];
+}
+
+LINKSTATUS graph_get_link_status(Graph* graph, Id id, DIRECTION dir) {
+  int e = graph_utils_edge(graph, id, dir);
+
+  if (e < 0)
+    return CLOSED;
+  return graph->status[graph->slot[e]];
+}
+
+Id graph_get_open_neighbour(Graph* graph, Id id, DIRECTION dir) {
+  int e = graph_utils_edge(graph, id, dir);
+
+  if (e < 0 || graph->status[graph->slot[e]] == CLOSED)
+    return NO_ID;
+  return graph->to[e];
+}
+
+int graph_get_number_of_edges(Graph* graph, Id id) {
+  int row;
+
+  if (!graph)
+    return -1;
+  row = id_table_find(graph->rows, id);
+  if (row == NO_ENTRY)
+    return -1;
+
+  return graph->first[row+1] - graph->first[row];
+}
+
+Id graph_get_edge(Graph* graph, Id id, int index, DIRECTION* dir) {
+  int row, e;
+
+  if (!graph)
+    return NO_ID;
+  row = id_table_find(graph->rows, id);
+  if (row == NO_ENTRY || index < 0)
+    return NO_ID;
+  e = graph->first[row] + index;
+  if (e >= graph->first[row+1])
+    return NO_ID;
+
+  if (dir)
+    *dir = graph->dir[e];
+  return graph->to[e];
+}
+
+Id graph_utils_space_link(Space* space, DIRECTION dir) {
+  switch (dir) {
+    case N: return space_get_north(space);
+    case S: return space_get_south(space);
+    case E: return space_get_east(space);
+    case W: return space_get_west(space);
+    case U: return space_get_up(space);
+    case D: return space_get_down(space);
+  }
+  return NO_ID;
+}
+
+Id_table* graph_utils_table(Id* ids, int n) {
+  Id_table *table = NULL;
+  int i;
+
+  table = id_table_create();
+  if (!table)
+    return NULL;
+
+  for (i=0; i<n; i++) {
+    if (ids[i] != NO_ID && id_table_add(table, ids[i], i) == ERROR) {
+      id_table_destroy(table);
+      return NULL;
+    }
+  }
+
+  return table;
+}
+
+int graph_utils_edge(Graph* graph, Id id, DIRECTION dir) {
+  int row, e;
+
+  if (!graph)
+    return -1;
+  row = id_table_find(graph->rows, id);
+  if (row == NO_ENTRY)
+    return -1;
+
+  /* A row has one edge at most for each direction */
+  for (e = graph->first[row]; e < graph->first[row+1]; e++) {
+    if (graph->dir[e] == dir)
+      return e;
+  }
+
+  return -1;
+}
+
+void graph_utils_clear(Graph* graph) {
+  int i;
+
+  for (i=0; i<graph->n_links; i++)
+    link_set_status_slot(graph->links[i], NULL);
+
+  id_table_destroy(graph->rows);
+  free(graph->first);
+  free(graph->dir);
+  free(graph->to);
+  free(graph->link);
+  free(graph->slot);
+  free(graph->status);
+  free(graph->links);
+  graph->rows = NULL;
+  graph->first = NULL;
+  graph->dir = NULL;
+  graph->to = NULL;
+  graph->link = NULL;
+  graph->slot = NULL;
+  graph->status = NULL;
+  graph->links = NULL;
+  graph->n_spaces = graph->n_edges = graph->n_links = 0;
+}
@@ -0,0 +1,215 @@
+/**
+ * @brief It tests graph module
+ *
+ * @file graph_test.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "graph_test.h"
+#define MAX_TESTS 12
+
+/**
+ * @brief Spaces of the world used by the tests
+ */
+static Space* spaces[3];
+
+/**
+ * @brief Links of the world used by the tests
+ */
+static Link* links[2];
+
+/**
+ * @brief Makes a world of three spaces in a row, 1 north of 2 and 2 west of 3,
+ * joined by the links 10 (opened) and 20 (closed)
+ */
+void world_create();
+
+/**
+ * @brief Destroyes the world of the tests
+ */
+void world_destroy();
+
+/**
+ * @brief Main function to test graph module.
+ *
+ * Two execution options:
+ *   1.-If no parameters, all test will run
+ *   2.-If you run with a number between 1 and the number of tests just run
+ *      the indicated test
+ *
+ */
+int main(int argc, char** argv) {
+
+    int test = 0;
+    int all = 1;
+
+    if (argc < 2) {
+        printf("Running all test for module graph:\n");
+    } else {
+        test = atoi(argv[1]);
+        all = 0;
+        printf("Running test %d:\t", test);
+	if (test < 1 || test > MAX_TESTS) {
+	  printf("Error: unknown test %d\t", test);
+	  exit(EXIT_SUCCESS);
+        }
+    }
+
+
+    if (all || test == 1) test1_graph_create();
+    if (all || test == 2) test1_graph_build();
+    if (all || test == 3) test2_graph_build();
+    if (all || test == 4) test1_graph_get_neighbour();
+    if (all || test == 5) test2_graph_get_neighbour();
+    if (all || test == 6) test1_graph_get_link();
+    if (all || test == 7) test1_graph_get_link_status();
+    if (all || test == 8) test2_graph_get_link_status();
+    if (all || test == 9) test1_graph_get_number_of_edges();
+    if (all || test == 10) test1_graph_get_edge();
+    if (all || test == 11) test1_graph_destroy();
+    if (all || test == 12) test1_graph_get_open_neighbour();
+
+
+    PRINT_PASSED_PERCENTAGE;
+
+    return EXIT_SUCCESS;
+}
+
+void world_create() {
+    spaces[0] = space_create(1);
+    spaces[1] = space_create(2);
+    spaces[2] = space_create(3);
+    links[0] = link_create(10);
+    links[1] = link_create(20);
+
+    space_set_south(spaces[0], 10);
+    space_set_north(spaces[1], 10);
+    space_set_east(spaces[1], 20);
+    space_set_west(spaces[2], 20);
+    /* A link that does not exist is not an edge */
+    space_set_down(spaces[2], 99);
+
+    link_set_north(links[0], 1);
+    link_set_south(links[0], 2);
+    link_set_status(links[0], OPENED);
+    link_set_north(links[1], 2);
+    link_set_south(links[1], 3);
+}
+
+void world_destroy() {
+    int i;
+    for (i=0; i<3; i++) space_destroy(spaces[i]);
+    for (i=0; i<2; i++) link_destroy(links[i]);
+}
+
+void test1_graph_create() {
+    Graph *graph = graph_create();
+    PRINT_TEST_RESULT(graph != NULL && graph_get_neighbour(graph, 1, N) == NO_ID);
+    graph_destroy(graph);
+}
+
+void test1_graph_build() {
+    Graph *graph = graph_create();
+    world_create();
+    PRINT_TEST_RESULT(graph_build(graph, spaces, 3, links, 2) == OK);
+    graph_destroy(graph);
+    world_destroy();
+}
+
+void test2_graph_build() {
+    PRINT_TEST_RESULT(graph_build(NULL, spaces, 3, links, 2) == ERROR);
+}
+
+void test1_graph_get_neighbour() {
+    Graph *graph = graph_create();
+    world_create();
+    graph_build(graph, spaces, 3, links, 2);
+    PRINT_TEST_RESULT(graph_get_neighbour(graph, 1, S) == 2 && graph_get_neighbour(graph, 2, N) == 1 && graph_get_neighbour(graph, 2, E) == 3 && graph_get_neighbour(graph, 3, W) == 2);
+    graph_destroy(graph);
+    world_destroy();
+}
+
+void test2_graph_get_neighbour() {
+    Graph *graph = graph_create();
+    world_create();
+    graph_build(graph, spaces, 3, links, 2);
+    PRINT_TEST_RESULT(graph_get_neighbour(graph, 1, N) == NO_ID && graph_get_neighbour(graph, 3, D) == NO_ID && graph_get_neighbour(graph, 7, S) == NO_ID);
+    graph_destroy(graph);
+    world_destroy();
+}
+
+void test1_graph_get_link() {
+    Graph *graph = graph_create();
+    world_create();
+    graph_build(graph, spaces, 3, links, 2);
+    PRINT_TEST_RESULT(graph_get_link(graph, 2, E) == 20 && graph_get_link(graph, 3, D) == NO_ID);
+    graph_destroy(graph);
+    world_destroy();
+}
+
+void test1_graph_get_link_status() {
+    Graph *graph = graph_create();
+    world_create();
+    graph_build(graph, spaces, 3, links, 2);
+    PRINT_TEST_RESULT(graph_get_link_status(graph, 1, S) == OPENED && graph_get_link_status(graph, 2, E) == CLOSED && graph_get_link_status(graph, 1, N) == CLOSED);
+    graph_destroy(graph);
+    world_destroy();
+}
+
+void test2_graph_get_link_status() {
+    Graph *graph = graph_create();
+    world_create();
+    graph_build(graph, spaces, 3, links, 2);
+    /* The status of the link is the slot of the graph */
+    link_set_status(links[1], OPENED);
+    PRINT_TEST_RESULT(graph_get_link_status(graph, 3, W) == OPENED && graph_get_link_status(graph, 2, E) == OPENED);
+    graph_destroy(graph);
+    world_destroy();
+}
+
+void test1_graph_get_number_of_edges() {
+    Graph *graph = graph_create();
+    world_create();
+    graph_build(graph, spaces, 3, links, 2);
+    PRINT_TEST_RESULT(graph_get_number_of_edges(graph, 2) == 2 && graph_get_number_of_edges(graph, 3) == 1 && graph_get_number_of_edges(graph, 7) == -1);
+    graph_destroy(graph);
+    world_destroy();
+}
+
+void test1_graph_get_edge() {
+    Graph *graph = graph_create();
+    DIRECTION dir = D;
+    Id to;
+    world_create();
+    graph_build(graph, spaces, 3, links, 2);
+    to = graph_get_edge(graph, 2, 1, &dir);
+    PRINT_TEST_RESULT(to == 3 && dir == E && graph_get_edge(graph, 2, 2, NULL) == NO_ID);
+    graph_destroy(graph);
+    world_destroy();
+}
+
+void test1_graph_destroy() {
+    Graph *graph = graph_create();
+    world_create();
+    graph_build(graph, spaces, 3, links, 2);
+    link_set_status(links[1], OPENED);
+    graph_destroy(graph);
+    /* The links keep their status without the graph */
+    PRINT_TEST_RESULT(link_get_status(links[1]) == OPENED && link_get_status(links[0]) == OPENED);
+    world_destroy();
+}
+
+void test1_graph_get_open_neighbour() {
+    Graph *graph = graph_create();
+    world_create();
+    graph_build(graph, spaces, 3, links, 2);
+    PRINT_TEST_RESULT(graph_get_open_neighbour(graph, 1, S) == 2 && graph_get_open_neighbour(graph, 2, E) == NO_ID && graph_get_open_neighbour(graph, 1, N) == NO_ID);
+    graph_destroy(graph);
+    world_destroy();
+}
@@ -11,8 +11,41 @@
 #include <string.h>
 #include "screen.h"
 #include "graphic_engine.h"
+#include "layout.h"
 
 
+#define MAP_CACHE_SIZE 16 /*!< Maps of spaces kept already composed */
+
+#define BORDER "\033[0m\033[0;32;42m~\033[0m" /*!< Left and right border of the map lines */
+#define LINE_END 181      /*!< Column where the right border starts */
+#define LINK_COLUMN 87    /*!< Column of the north and south links */
+#define GDESC_COLUMN 26   /*!< Column where the graphic description starts */
+#define GDESC_WIDTH 130   /*!< Columns of the graphic description */
+
+/**
+ * @brief Map cache
+ *
+ * This structure keeps the map area composed for a space
+ */
+typedef struct {
+  Id id;          /*!< Space the map was composed for */
+  long version;   /*!< Map version of the game when it was composed */
+  char *map;      /*!< Contents of the map area */
+  int len;        /*!< Length of the contents */
+  int size;       /*!< Bytes allocated for map */
+} Map_cache;
+
+/**
+ * @brief Render backend
+ *
+ * This structure defines where the frames of the graphic engine end up
+ */
+typedef struct {
+  STATUS (*open)(Graphic_engine *ge, const char *file);  /*!< Prepares the backend */
+  void (*paint)(Graphic_engine *ge, Game *game);        /*!< Paints a frame of the game */
+  void (*close)(Graphic_engine *ge);                    /*!< Releases the backend */
+} Render;
+
 /**
  * @brief Graphic engine
  *
@@ -24,22 +57,90 @@ struct _Graphic_engine {
   *banner,     /*!< Banner of the game*/
   *help,       /*!< Help area*/
   *feedback;   /*!< Feedback area*/
+  Map_cache maps[MAP_CACHE_SIZE]; /*!< Maps already composed, by space */
+  Layout *line;                   /*!< Line being composed */
+  const Render *render;           /*!< Backend the frames are painted with */
+  Id map_id;                      /*!< Space the map area was written for */
+  long map_version;               /*!< Map version the map area was written for */
+  Id descript_id;                 /*!< Space the description area was written for */
+  long descript_version;          /*!< Description version the description area was written for */
+  FILE *snapshot;                 /*!< File the frames are written on by the snapshot backend */
 };
 
+/****************************/
+/*     Private functions    */
+/****************************/
+
+STATUS graphic_engine_terminal_open(Graphic_engine *ge, const char *file);
+void graphic_engine_terminal_paint(Graphic_engine *ge, Game *game);
+void graphic_engine_terminal_close(Graphic_engine *ge);
+
+STATUS graphic_engine_null_open(Graphic_engine *ge, const char *file);
+void graphic_engine_null_paint(Graphic_engine *ge, Game *game);
+void graphic_engine_null_close(Graphic_engine *ge);
+
+STATUS graphic_engine_snapshot_open(Graphic_engine *ge, const char *file);
+void graphic_engine_snapshot_paint(Graphic_engine *ge, Game *game);
+void graphic_engine_snapshot_close(Graphic_engine *ge);
+
+void graphic_engine_compose(Graphic_engine *ge, Game *game);
+
+/**
+ * @brief Render backends, in the order of RENDER
+ */
+static const Render renders[] = {
+  {graphic_engine_terminal_open, graphic_engine_terminal_paint, graphic_engine_terminal_close},
+  {graphic_engine_null_open, graphic_engine_null_paint, graphic_engine_null_close},
+  {graphic_engine_snapshot_open, graphic_engine_snapshot_paint, graphic_engine_snapshot_close}
+};
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
 Graphic_engine *graphic_engine_create() {
+  return graphic_engine_create_render(TERMINAL_RENDER, NULL);
+}
+
+Graphic_engine *graphic_engine_create_render(RENDER render, const char *file) {
   static Graphic_engine *ge = NULL;
+  int i;
 
   if (ge)
     return ge;
+  if (render < TERMINAL_RENDER || render > SNAPSHOT_RENDER)
+    return NULL;
 
-  screen_init();
   ge = (Graphic_engine *) malloc(sizeof(Graphic_engine));
+  if (!ge)
+    return NULL;
+  for (i=0; i<MAP_CACHE_SIZE; i++) {
+    ge->maps[i].id = NO_ID;
+    ge->maps[i].version = -1;
+    ge->maps[i].map = NULL;
+    ge->maps[i].len = 0;
+    ge->maps[i].size = 0;
+  }
 
   ge->map      = screen_area_init(MAX_LINE_SIZE);
   ge->descript = screen_area_init(MAX_LINE_SIZE);
   ge->banner   = screen_area_init(WORD_SIZE);
   ge->help     = screen_area_init(WORD_SIZE);
   ge->feedback = screen_area_init(WORD_SIZE);
+  ge->line     = layout_create(WORD_SIZE);
+  ge->render   = &renders[render];
+  ge->snapshot = NULL;
+  ge->map_id = NO_ID;
+  ge->map_version = -1;
+  ge->descript_id = NO_ID;
+  ge->descript_version = -1;
+
+  /* The frame buffer is sized from the areas, so they go first */
+  if (ge->render->open(ge, file) == ERROR) {
+    ge->render = &renders[NULL_RENDER];
+    graphic_engine_destroy(ge);
+    ge = NULL;
+  }
 
   return ge;
 }
@@ -58,26 +159,29 @@ STATUS graphic_engine_space_objects_print(Game* game, Id id, char* obj) {
   if (!game || id==NO_ID || !obj)
     return ERROR;
   for (i=0; i<space_get_number_of_objects(game_get_space(game, id)); i++) {
-    strncpy(obj+strlen(obj), " ", WORD_SIZE);
-    strncpy(obj+strlen(obj), object_get_name(game_get_object(game, space_get_object(game_get_space(game, id), i))), WORD_SIZE);
+    strncat(obj, " ", WORD_SIZE-strlen(obj));
+    strncat(obj, object_get_name(game_get_object(game, space_get_object(game_get_space(game, id), i))), WORD_SIZE-strlen(obj));
   }
   return OK;
 }
 
 STATUS graphic_engine_player_objects_print(Game* game, char* obj) {
-  int i;
-  Id id_obj;
+  int i, n = 0;
+  const Id *objects = NULL;
   strncpy(obj, "\0", WORD_SIZE);
   if (!game || !obj)
     return ERROR;
-  for (i=0; (id_obj=player_get_object(game_get_player(game), i))!=NO_ID; i++) {
+  objects = player_get_objects(game_get_player(game), &n);
+  for (i=0; i<n; i++) {
     strcpy(obj+strlen(obj), " ");
-    strcpy(obj+strlen(obj), object_get_name(game_get_object(game, id_obj)));
+    strcpy(obj+strlen(obj), object_get_name(game_get_object(game, objects[i])));
   }
   return OK;
 }
 
 void graphic_engine_destroy(Graphic_engine *ge) {
+  int i;
+
   if (!ge)
     return;
 
@@ -86,332 +190,469 @@ void graphic_engine_destroy(Graphic_engine *ge) {
   screen_area_destroy(ge->banner);
   screen_area_destroy(ge->help);
   screen_area_destroy(ge->feedback);
+  layout_destroy(ge->line);
+  for (i=0; i<MAP_CACHE_SIZE; i++) {
+    if (ge->maps[i].map)
+      free(ge->maps[i].map);
+  }
 
-  screen_destroy();
+  ge->render->close(ge);
   free(ge);
 }
 
-void graphic_engine_paint_game(Graphic_engine *ge, Game *game) {
-  Id id_act = NO_ID, id_back = NO_ID, id_next = NO_ID, id_east=NO_ID, id_west=NO_ID, p_obj;
+/**
+ * @brief Ends a map line with a line of a graphic description
+ *
+ * graphic_engine_gdesc_line_print(Graphic_engine *ge, Space *space, int i) appends to the line
+ * being composed the i-th line of the graphic description of the space, fitted to its column,
+ * and writes the whole line on the map area.
+ * @param ge, pointer to the graphic engine.
+ * @param space, pointer to the space painted.
+ * @param i, line of the graphic description.
+ * @return OK if the process is completed succesfully, ERRROR otherwise
+ */
+STATUS graphic_engine_gdesc_line_print(Graphic_engine *ge, Space *space, int i) {
+  const char *gdesc = NULL;
+
+  if (!ge || !space)
+    return ERROR;
+
+  gdesc = space_get_gdesc(space, i);
+  layout_pad(ge->line, GDESC_COLUMN, ' ');
+  layout_fit(ge->line, gdesc ? gdesc : "", GDESC_WIDTH, FALSE);
+  layout_pad(ge->line, LINE_END, ' ');
+  layout_puts(ge->line, BORDER);
+
+  return screen_area_puts(ge->map, layout_get_string(ge->line));
+}
+
+/**
+ * @brief Ends a line of a text area
+ *
+ * graphic_engine_text_line_print(Graphic_engine *ge, Area *area) fills the line being composed
+ * with the background up to the right border and writes it on the area.
+ * @param ge, pointer to the graphic engine.
+ * @param area, pointer to the area the line belongs to.
+ * @return OK if the process is completed succesfully, ERRROR otherwise
+ */
+STATUS graphic_engine_text_line_print(Graphic_engine *ge, Area *area) {
+  STATUS st;
+
+  if (!ge || !area)
+    return ERROR;
+
+  layout_puts(ge->line, "\033[0;30;40m");
+  layout_pad(ge->line, LINE_END, ' ');
+  layout_puts(ge->line, "\033[0m\033[0;32;42m~\033[0m");
+  st = screen_area_puts(area, layout_get_string(ge->line));
+  layout_clear(ge->line);
+
+  return st;
+}
+
+/**
+ * @brief Composes the map of a space
+ *
+ * graphic_engine_map_print(Graphic_engine *ge, Game* game, Id id_act) writes on the map area
+ * the graphic description of the space and the links to its neighbours.
+ * @param ge, pointer to the graphic engine.
+ * @param game, pointer to the game the space belongs to.
+ * @param id_act, identifier of the space the player is in.
+ * @return OK if the process is completed succesfully, ERRROR otherwise
+ */
+STATUS graphic_engine_map_print(Graphic_engine *ge, Game* game, Id id_act) {
+  Id id_back = NO_ID, id_next = NO_ID, id_east=NO_ID, id_west=NO_ID;
   Space* space_act = NULL;
-  char obj[WORD_SIZE + 1]="\0";
+  Layout* line = NULL;
   char str[WORD_SIZE + 1]="\0";
-  char description[WORD_SIZE + 1]="\0";
-  char north_description[WORD_SIZE + 1]="\0";
-  char south_description[WORD_SIZE + 1]="\0";
-  char east_description[WORD_SIZE + 1]="\0";
-  char west_description[WORD_SIZE + 1]="\0";
-  char full_description[WORD_SIZE +1]="\0";
-  char rules_string[WORD_SIZE +1]="\0";
   int desclength;
-  int i, gaps;
-
-  screen_init();
-
-  /* Paint the in the map area */
-  screen_area_clear(ge->map);
-  if ((id_act = player_get_location(game_get_player(game))) != NO_ID) {
-    space_act = game_get_space(game, id_act);
-    id_back = link_get_space(game_get_link(game, space_get_north(space_act)), id_act);
-    id_next = link_get_space(game_get_link(game, space_get_south(space_act)), id_act);
-
-    id_west=link_get_space(game_get_link(game, space_get_west(space_act)), id_act);
-    id_east=link_get_space(game_get_link(game, space_get_east(space_act)), id_act);
-
-    /* Getting descriptions */
-    if (id_back!=NO_ID) {
-      strncpy(north_description, space_get_description(game_get_space(game, id_back)), WORD_SIZE);
-    }
+  int i;
 
-    if (id_next!=NO_ID) {
-      strncpy(south_description, space_get_description(game_get_space(game, id_next)), WORD_SIZE);
-    }
+  if (!ge || !game || id_act == NO_ID)
+    return ERROR;
 
-    if (id_east!=NO_ID) {
-      strncpy(east_description, space_get_description(game_get_space(game, id_east)), 23);
-    }
+  line = ge->line;
+  space_act = game_get_space(game, id_act);
+  id_back = game_get_neighbour(game, id_act, N);
+  id_next = game_get_neighbour(game, id_act, S);
+
+  id_west=game_get_neighbour(game, id_act, W);
+  id_east=game_get_neighbour(game, id_act, E);
+
+  /* The name of the space is cut to 17 columns */
+  desclength=layout_width(space_get_description(space_act));
+  if (desclength > 17)
+    desclength = 17;
+  else if (desclength < 0)
+    desclength = 0;
+
+  /* Painting first line */
+  layout_clear(line);
+  layout_puts(line, BORDER);
+  layout_pad(line, 1+desclength+7, ' ');
+  layout_puts(line, "|");
+  if (id_back != NO_ID) {
+    layout_pad(line, LINK_COLUMN, ' ');
+    sprintf(str, "%3d ^ ", (int)game_get_neighbour_link(game, id_act, N));
+    layout_puts(line, str);
+    layout_puts(line, space_get_description(game_get_space(game, id_back)));
+  }
+  layout_pad(line, LINE_END, ' ');
+  layout_puts(line, BORDER);
+  screen_area_puts(ge->map, layout_get_string(line));
+
+  /* Painting second line */
+  layout_clear(line);
+  layout_puts(line, BORDER);
+  sprintf(str, " %3d- ", (int)id_act);
+  layout_puts(line, str);
+  layout_fit(line, space_get_description(space_act), desclength, FALSE);
+  layout_puts(line, " |");
+  graphic_engine_gdesc_line_print(ge, space_act, 1);
+
+  /* Painting tirth line */
+  layout_clear(line);
+  layout_puts(line, BORDER);
+  layout_pad(line, 1+desclength+7, ' ');
+  layout_puts(line, "|");
+  graphic_engine_gdesc_line_print(ge, space_act, 2);
+
+  /* Painting fourth line */
+  layout_clear(line);
+  layout_puts(line, BORDER);
+  layout_pad(line, 1+desclength+7, '-');
+  layout_puts(line, "+");
+  graphic_engine_gdesc_line_print(ge, space_act, 3);
+
+  /* Painting until gdesc pre-middle line*/
+  for (i=4; i<=(MAX_GDESC_LINES/2)-1; i++) {
+    layout_clear(line);
+    layout_puts(line, BORDER);
+    graphic_engine_gdesc_line_print(ge, space_act, i);
+  }
 
-    if (id_west!=NO_ID) {
-      strncpy(west_description, space_get_description(game_get_space(game, id_west)), 23);
-    }
+  /* Painting gdesc pre-middle line*/
+  layout_clear(line);
+  layout_puts(line, BORDER);
+  if (id_west!=NO_ID) {
+    layout_puts(line, " ");
+    layout_fit(line, space_get_description(game_get_space(game, id_west)), 23, TRUE);
+  }
+  if (id_east!=NO_ID) {
+    layout_pad(line, GDESC_COLUMN, ' ');
+    layout_fit(line, space_get_gdesc(space_act, MAX_GDESC_LINES/2), GDESC_WIDTH, FALSE);
+    layout_puts(line, " ");
+    layout_fit(line, space_get_description(game_get_space(game, id_east)), 23, FALSE);
+    layout_pad(line, LINE_END, ' ');
+    layout_puts(line, BORDER);
+    screen_area_puts(ge->map, layout_get_string(line));
+  }
+  else
+    graphic_engine_gdesc_line_print(ge, space_act, MAX_GDESC_LINES/2);
+
+  /* Paintng gdesc middle line*/
+  layout_clear(line);
+  layout_puts(line, BORDER);
+  if (id_west!=NO_ID) {
+    sprintf(str, "     %3d <---------", (int)game_get_neighbour_link(game, id_act, W));
+    layout_puts(line, str);
+  }
+  if (id_east!=NO_ID) {
+    layout_pad(line, GDESC_COLUMN, ' ');
+    layout_fit(line, space_get_gdesc(space_act, (MAX_GDESC_LINES/2)+1), GDESC_WIDTH, FALSE);
+    sprintf(str, "     ---------> %-3d", (int)game_get_neighbour_link(game, id_act, E));
+    layout_puts(line, str);
+    layout_pad(line, LINE_END, ' ');
+    layout_puts(line, BORDER);
+    screen_area_puts(ge->map, layout_get_string(line));
+  }
+  else
+    graphic_engine_gdesc_line_print(ge, space_act, (MAX_GDESC_LINES/2)+1);
+
+  /* Painting the until the end*/
+  for (i=(MAX_GDESC_LINES/2)+2; i<=MAX_GDESC_LINES; i++) {
+    layout_clear(line);
+    layout_puts(line, BORDER);
+    graphic_engine_gdesc_line_print(ge, space_act, i);
+  }
 
-    /* Painting first line */
-    strncpy(description, space_get_description(game_get_space(game, id_act)), 17);
-    desclength=strlen(description);
-    sprintf(str, "\033[0m\033[0;32;42m~\033[0m");
-    for (i=0; i<=(desclength+6); i++) {
-      sprintf(str+strlen(str), " ");
-    }
-    sprintf(str+strlen(str), "|");
-    if (id_back != NO_ID) {
-      while(strlen(str)<87+18) {
-        sprintf(str+strlen(str), " ");
-      }
-      sprintf(str+strlen(str), "%3d ^ %s", (int)link_get_id(game_get_link(game, space_get_north(game_get_space(game, id_act)))), north_description);
-    }
-    while(strlen(str)<181+18) {
-      sprintf(str+strlen(str), " ");
-    }
-    sprintf(str+strlen(str), "\033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->map, str);
+  /* Painting last line */
+  layout_clear(line);
+  layout_puts(line, BORDER);
+  if (id_next != NO_ID) {
+    layout_pad(line, LINK_COLUMN, ' ');
+    sprintf(str, "%3d v ", (int)game_get_neighbour_link(game, id_act, S));
+    layout_puts(line, str);
+    layout_puts(line, space_get_description(game_get_space(game, id_next)));
+  }
+  layout_pad(line, LINE_END, ' ');
+  layout_puts(line, BORDER);
+  screen_area_puts(ge->map, layout_get_string(line));
+  layout_clear(line);
 
-    if (id_act != NO_ID) {
-      /* Painting second line */
+  return OK;
+}
 
-      strncpy(str, "\0", WORD_SIZE);
-      sprintf(str, "\033[0m\033[0;32;42m~\033[0m");
-      sprintf(str+strlen(str), " %3d- %s |", (int)id_act, description);
-      while(strlen(str)<26+18) {
-        sprintf(str+strlen(str), " ");
-      }
-      strncpy(obj, space_get_gdesc(game_get_space(game, id_act), 1), WORD_SIZE);
-      sprintf(str+strlen(str), "%s", obj);
-      sprintf(str+strlen(str), "                         \033[0m\033[0;32;42m~\033[0m");
-      screen_area_puts(ge->map, str);
-
-      /* Painting tirth line */
-
-      strncpy(str, "\0", WORD_SIZE);
-      sprintf(str, "\033[0m\033[0;32;42m~\033[0m");
-      if (desclength<17) {
-        for (i=0; i<=(desclength+6); i++) {
-          sprintf(str+strlen(str), " ");
-        }
-      }
-      else
-        sprintf(str+strlen(str), "                        ");
-      sprintf(str+strlen(str), "|");
-      while(strlen(str)<26+18) {
-        sprintf(str+strlen(str), " ");
-      }
-      strncpy(obj, space_get_gdesc(game_get_space(game, id_act), 2), WORD_SIZE);
-      sprintf(str+strlen(str), "%s", obj);
-      sprintf(str+strlen(str), "                         \033[0m\033[0;32;42m~\033[0m");
-      screen_area_puts(ge->map, str);
-
-      /* Painting fourth line */
-
-      strncpy(str, "\0", WORD_SIZE);
-      sprintf(str, "\033[0m\033[0;32;42m~\033[0m");
-      if (desclength<17) {
-        for (i=0; i<=(desclength+6); i++) {
-          sprintf(str+strlen(str), "-");
-        }
-      }
-      else
-        sprintf(str+strlen(str), "------------------------");
-      sprintf(str+strlen(str), "+");
-      while(strlen(str)<26+18) {
-        sprintf(str+strlen(str), " ");
-      }
-      strncpy(obj, space_get_gdesc(game_get_space(game, id_act), 3), WORD_SIZE);
-      sprintf(str+strlen(str), "%s", obj);
-      sprintf(str+strlen(str), "                         \033[0m\033[0;32;42m~\033[0m");
-      screen_area_puts(ge->map, str);
-
-      /* Painting until gdesc pre-middle line*/
-
-      for (i=4; i<=(MAX_GDESC_LINES/2)-1; i++) {
-        strncpy(str, "\0", WORD_SIZE);
-        sprintf(str, "\033[0m\033[0;32;42m~\033[0m");
-        strncpy(obj, space_get_gdesc(game_get_space(game, id_act), i), WORD_SIZE);
-        sprintf(str+strlen(str), "                         %s", obj);
-        sprintf(str+strlen(str), "                         \033[0m\033[0;32;42m~\033[0m");
-        screen_area_puts(ge->map, str);
-      }
+/**
+ * @brief Keeps a copy of the map area
+ *
+ * graphic_engine_map_cache(Map_cache *cached, Area *map, Id id, long version) stores the
+ * contents of the map area as the map of the space (id) for the given map version.
+ * @param cached, pointer to the cache entry to fill.
+ * @param map, pointer to the map area already composed.
+ * @param id, identifier of the space painted.
+ * @param version, map version of the game when it was painted.
+ * @return OK if the process is completed succesfully, ERRROR otherwise
+ */
+STATUS graphic_engine_map_cache(Map_cache *cached, Area *map, Id id, long version) {
+  char *aux = NULL;
+  int len;
 
-      /* Painting gdesc pre-middle line*/
-
-      strncpy(str, "\0", WORD_SIZE);
-      sprintf(str, "\033[0m\033[0;32;42m~\033[0m");
-      if (id_west!=NO_ID)
-        sprintf(str+strlen(str), " %23s ", west_description);
-      else
-        sprintf(str+strlen(str), "                         ");
-      strncpy(obj, space_get_gdesc(game_get_space(game, id_act), MAX_GDESC_LINES/2), WORD_SIZE);
-      sprintf(str+strlen(str), "%s", obj);
-
-      if (id_east!=NO_ID) {
-        sprintf(str+strlen(str), " %-23s ", east_description);
-        while(strlen(str)<181+18) {
-          sprintf(str+strlen(str), " ");
-        }
-      }
-      else
-        sprintf(str+strlen(str), "                         ");
-      sprintf(str+strlen(str), "\033[0m\033[0;32;42m~\033[0m");
-      screen_area_puts(ge->map, str);
-
-      /* Paintng gdesc middle line*/
-
-      strncpy(str, "\0", WORD_SIZE);
-      sprintf(str, "\033[0m\033[0;32;42m~\033[0m");
-      if (id_west!=NO_ID)
-        sprintf(str+strlen(str), "     %3d <---------      ", (int)link_get_id(game_get_link(game, space_get_west(game_get_space(game, id_act)))));
-      else
-        sprintf(str+strlen(str), "                         ");
-
-      strncpy(obj, space_get_gdesc(game_get_space(game, id_act), (MAX_GDESC_LINES/2)+1), WORD_SIZE);
-      sprintf(str+strlen(str), "%s", obj);
-
-      if (id_east!=NO_ID)
-        sprintf(str+strlen(str), "     ---------> %-3d      \033[0m\033[0;32;42m~\033[0m", (int)link_get_id(game_get_link(game, space_get_east(game_get_space(game, id_act)))));
-      else
-        sprintf(str+strlen(str), "                         \033[0m\033[0;32;42m~\033[0m");
-      screen_area_puts(ge->map, str);
-
-      /* Painting the until the end*/
-
-      for (i=(MAX_GDESC_LINES/2)+2; i<=MAX_GDESC_LINES; i++) {
-        strncpy(str, "\0", WORD_SIZE);
-        sprintf(str, "\033[0m\033[0;32;42m~\033[0m");
-        strncpy(obj, space_get_gdesc(game_get_space(game, id_act), i), WORD_SIZE);
-        sprintf(str+strlen(str), "                         %s", obj);
-        sprintf(str+strlen(str), "                         \033[0m\033[0;32;42m~\033[0m");
-        screen_area_puts(ge->map, str);
-      }
+  if (!cached || !map)
+    return ERROR;
 
-      /* Painting last line */
-      strncpy(str, "\0", WORD_SIZE);
-      sprintf(str, "\033[0m\033[0;32;42m~\033[0m");
-      if (id_next != NO_ID) {
-        while(strlen(str)<87+18) {
-          sprintf(str+strlen(str), " ");
-        }
-        sprintf(str+strlen(str), "%3d v %s", (int)link_get_id(game_get_link(game, space_get_south(game_get_space(game, id_act)))), south_description);
-      }
-      while(strlen(str)<181+18) {
-        sprintf(str+strlen(str), " ");
-      }
-      sprintf(str+strlen(str), "\033[0m\033[0;32;42m~\033[0m");
-      screen_area_puts(ge->map, str);
+  len = screen_area_get_length(map);
+  if (!cached->map || cached->size < len+1) {
+    aux = (char *) realloc(cached->map, (len+1)*sizeof(char));
+    if (!aux) {
+      cached->id = NO_ID;
+      return ERROR;
     }
+    cached->map = aux;
+    cached->size = len+1;
   }
+  memcpy(cached->map, screen_area_get_string(map), len+1);
+  cached->len = len;
+  cached->id = id;
+  cached->version = version;
+
+  return OK;
+}
+
+void graphic_engine_paint_game(Graphic_engine *ge, Game *game) {
+  if (!ge || !game)
+    return;
+  ge->render->paint(ge, game);
+}
+
+/**
+ * @brief Composes the description area
+ *
+ * graphic_engine_descript_print(Graphic_engine *ge, Game* game, Id id_act) writes on the description
+ * area the space the player is in, the inspected text, the objects around, the objects of the
+ * player and the last die value.
+ * @param ge, pointer to the graphic engine.
+ * @param game, pointer to the game.
+ * @param id_act, identifier of the space the player is in.
+ */
+void graphic_engine_descript_print(Graphic_engine *ge, Game* game, Id id_act) {
+  char obj[WORD_SIZE + 1]="\0";
+  char str[WORD_SIZE + 1]="\0";
+  int i, n = 0;
 
-  /* Paint the in the description area */
   screen_area_clear(ge->descript);
   strncpy(obj, " ", WORD_SIZE);
   graphic_engine_space_objects_print(game, id_act, obj);
 
+  layout_clear(ge->line);
+  layout_puts(ge->line, "\033[0;32;42m~\033[0m\033[0;30;40m \033[0m\033[4;37;40mDescription:\033[0m\033[0;30;40m \033[0m\033[0;37;40m");
+  layout_puts(ge->line, space_get_description(game_get_space(game, id_act)));
+  layout_puts(ge->line, "\033[0m");
+  graphic_engine_text_line_print(ge, ge->descript);
+
+  layout_puts(ge->line, "\033[0;32;42m~\033[0m");
+  if (strcmp(game_get_full_description(game), "\0")!=0) {
+    layout_puts(ge->line, "\033[0;30;40m \033[0m\033[4;37;40mInspecting:\033[0m\033[0;30;40m \033[0m\033[0;37;40m");
+    layout_puts(ge->line, game_get_full_description(game));
+    layout_puts(ge->line, "\033[0m");
+  }
+  graphic_engine_text_line_print(ge, ge->descript);
 
-  strncpy(description, space_get_description(game_get_space(game, id_act)), WORD_SIZE);
-  sprintf(str, "\033[0;32;42m~\033[0m\033[0;30;40m \033[0m\033[4;37;40mDescription:\033[0m\033[0;30;40m \033[0m\033[0;37;40m%s\033[0m", description);
-  gaps=182-strlen(description)-15;
-  sprintf(str+strlen(str), "\033[0;30;40m ");
-  for (i=0; i<gaps-2; i++) {
-    sprintf(str+strlen(str), " ");
+  layout_puts(ge->line, "\033[0;32;42m~\033[0m");
+  if (strcmp(obj, "\0")!=0) {
+    layout_puts(ge->line, "\033[0;30;40m \033[0m\033[4;37;40mObjects in space:\033[0m\033[0;37;40m");
+    layout_puts(ge->line, obj);
+    layout_puts(ge->line, "\033[0m");
   }
-  sprintf(str+strlen(str), "\033[0m\033[0;32;42m~\033[0m");
-  screen_area_puts(ge->descript, str);
-
-  strncpy(full_description, game_get_full_description(game), WORD_SIZE);
-  if (strcmp(full_description, "\0")!=0) {
-    sprintf(str, "\033[0;32;42m~\033[0m\033[0;30;40m \033[0m\033[4;37;40mInspecting:\033[0m\033[0;30;40m \033[0m\033[0;37;40m%s\033[0m", full_description);
-    gaps=182-strlen(full_description)-14;
-    sprintf(str+strlen(str), "\033[0;30;40m ");
-    for (i=0; i<gaps-2; i++) {
-      sprintf(str+strlen(str), " ");
-    }
-    sprintf(str+strlen(str), "\033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->descript, str);
+  graphic_engine_text_line_print(ge, ge->descript);
+
+  layout_puts(ge->line, "\033[0;32;42m~\033[0m");
+  if (player_get_objects(game_get_player(game), &n) && n > 0) {
+    graphic_engine_player_objects_print(game, obj);
+    layout_puts(ge->line, "\033[0;30;40m \033[0m\033[4;37;40mPlayer objects:\033[0m\033[0;30;40m \033[0m\033[0;37;40m");
+    layout_puts(ge->line, obj);
+    layout_puts(ge->line, "\033[0m");
   }
-  else {
-    sprintf(str, "\033[0;32;42m~\033[0m\033[0;30;40m                                                                                                                                                                                    \033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->descript, str);
+  graphic_engine_text_line_print(ge, ge->descript);
+
+  layout_puts(ge->line, "\033[0;32;42m~\033[0m");
+  if ((i = game_get_die_last_value(game)) != DEFAULT_DIE_VALUE) {
+    sprintf(str, "\033[0;30;40m \033[0m\033[4;37;40mLast die value:\033[0m\033[0;30;40m \033[0m\033[0;37;40m%d\033[0m", i);
+    layout_puts(ge->line, str);
   }
+  graphic_engine_text_line_print(ge, ge->descript);
+}
 
-  if (strcmp(obj, "\0")!=0) {
-    sprintf(str, "\033[0;32;42m~\033[0m\033[0;30;40m \033[0m\033[4;37;40mObjects in space:\033[0m\033[0;37;40m%s\033[0m", obj);
-    gaps=182-strlen(obj)-19;
-    sprintf(str+strlen(str), "\033[0;30;40m ");
-    for (i=0; i<gaps-2; i++) {
-      sprintf(str+strlen(str), " ");
-    }
-    sprintf(str+strlen(str), "\033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->descript, str);
+/**
+ * @brief Composes the help area
+ *
+ * graphic_engine_help_print(Graphic_engine *ge) writes on the help area the commands of the game.
+ * @param ge, pointer to the graphic engine.
+ */
+void graphic_engine_help_print(Graphic_engine *ge) {
+  char str[WORD_SIZE + 1]="\0";
+
+  screen_area_clear(ge->help);
+  layout_puts(ge->line, "\033[0;32;42m~\033[0m\033[0;30;40m \033[0m\033[4;37;40mThe commands you can use are:\033[0m");
+  graphic_engine_text_line_print(ge, ge->help);
+  sprintf(str, "\033[0;32;42m~\033[0m\033[0;37;40m   move north or m n, move south or m s, move east or m e, move west or m w, next or n, back or b, right or r, left or l, take or t, drop or d, roll or rl, inspect or i, turnon or \033[0m\033[0;32;42m~\033[0m");
+  screen_area_puts(ge->help, str);
+  layout_puts(ge->line, "\033[0;32;42m~\033[0m\033[0;37;40m   ton, turnoff or toff, open or o, save or s, load or ld, exit or e\033[0m");
+  graphic_engine_text_line_print(ge, ge->help);
+}
+
+/**
+ * @brief Composes a frame of the game
+ *
+ * graphic_engine_compose(Graphic_engine *ge, Game *game) fills every area of the graphic
+ * engine with the current state of the game.
+ * @param ge, pointer to the graphic engine.
+ * @param game, pointer to the game painted.
+ */
+void graphic_engine_compose(Graphic_engine *ge, Game *game) {
+  Id id_act = NO_ID;
+  Map_cache *cached = NULL;
+
+  screen_reset();
+  id_act = player_get_location(game_get_player(game));
+
+  /* Only the areas whose contents changed are written again */
+  if (id_act != ge->map_id || game_get_map_version(game) != ge->map_version) {
+    ge->map_id = id_act;
+    ge->map_version = game_get_map_version(game);
+    screen_area_set_dirty(ge->map, TRUE);
   }
-  else {
-    sprintf(str, "\033[0;32;42m~\033[0m\033[0;30;40m                                                                                                                                                                                    \033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->descript, str);
+  /* The rules may move objects at random, so with them the description is always written */
+  if (id_act != ge->descript_id || game_get_descript_version(game) != ge->descript_version || game_get_game_run_rules(game) == RULE) {
+    ge->descript_id = id_act;
+    ge->descript_version = game_get_descript_version(game);
+    screen_area_set_dirty(ge->descript, TRUE);
   }
 
-  if ((p_obj = player_get_object(game_get_player(game), 0)) != NO_ID) {
-    graphic_engine_player_objects_print(game, obj);
-    sprintf(str, "\033[0;32;42m~\033[0m\033[0;30;40m \033[0m\033[4;37;40mPlayer objects:\033[0m\033[0;30;40m \033[0m\033[0;37;40m%s\033[0m", obj);
-    gaps=182-strlen(obj)-18;
-    sprintf(str+strlen(str), "\033[0;30;40m ");
-    for (i=0; i<gaps-2; i++) {
-      sprintf(str+strlen(str), " ");
+  /* Paint the in the map area */
+  if (screen_area_is_dirty(ge->map) == TRUE) {
+    screen_area_clear(ge->map);
+    if (id_act != NO_ID) {
+      /* Going back to a space reuses the map composed for it */
+      cached = &ge->maps[(unsigned long)id_act % MAP_CACHE_SIZE];
+      if (cached->map && cached->id == id_act && cached->version == game_get_map_version(game)) {
+        screen_area_write(ge->map, cached->map, cached->len);
+      }
+      else {
+        graphic_engine_map_print(ge, game, id_act);
+        graphic_engine_map_cache(cached, ge->map, id_act, game_get_map_version(game));
+      }
     }
-    sprintf(str+strlen(str), "\033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->descript, str);
-  }
-  else {
-    sprintf(str, "\033[0;32;42m~\033[0m\033[0;30;40m                                                                                                                                                                                    \033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->descript, str);
+    screen_area_set_dirty(ge->map, FALSE);
   }
 
-  if ((i = game_get_die_last_value(game)) != DEFAULT_DIE_VALUE) {
-    sprintf(str, "\033[0;32;42m~\033[0m\033[0;30;40m \033[0m\033[4;37;40mLast die value:\033[0m\033[0;30;40m \033[0m\033[0;37;40m%d\033[0m", i);
-    sprintf(str+strlen(str), "\033[0;30;40m                                                                                                                                                                  \033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->descript, str);
-  }
-  else {
-    sprintf(str, "\033[0;32;42m~\033[0m\033[0;30;40m                                                                                                                                                                                    \033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->descript, str);
+  /* Paint the in the description area */
+  if (screen_area_is_dirty(ge->descript) == TRUE) {
+    graphic_engine_descript_print(ge, game, id_act);
+    screen_area_set_dirty(ge->descript, FALSE);
   }
 
   /* Paint the in the banner area */
-  screen_area_clear(ge->banner);
-  screen_area_puts(ge->banner, "\033[0;30;47m ESCAPA DE LA UAM \033[0m");
+  if (screen_area_is_dirty(ge->banner) == TRUE) {
+    screen_area_clear(ge->banner);
+    screen_area_puts(ge->banner, "\033[0;30;47m ESCAPA DE LA UAM \033[0m");
+    screen_area_set_dirty(ge->banner, FALSE);
+  }
 
   /* Paint the in the help area */
-  screen_area_clear(ge->help);
-  sprintf(str, "\033[0;32;42m~\033[0m\033[0;30;40m \033[0m\033[4;37;40mThe commands you can use are:\033[0m");
-  sprintf(str+strlen(str), "\033[0;30;40m                                                                                                                                                      \033[0m\033[0;32;42m~\033[0m");
-  screen_area_puts(ge->help, str);
-  sprintf(str, "\033[0;32;42m~\033[0m\033[0;37;40m   move north or m n, move south or m s, move east or m e, move west or m w, next or n, back or b, right or r, left or l, take or t, drop or d, roll or rl, inspect or i, turnon or \033[0m\033[0;32;42m~\033[0m");
-  screen_area_puts(ge->help, str);
-  sprintf(str, "\033[0;32;42m~\033[0m\033[0;37;40m   ton, turnoff or toff, open or o, save or s, load or ld, exit or e\033[0m");
-  sprintf(str+strlen(str), "\033[0;30;40m                                                                                                                \033[0m\033[0;32;42m~\033[0m");
-  screen_area_puts(ge->help, str);
+  if (screen_area_is_dirty(ge->help) == TRUE) {
+    graphic_engine_help_print(ge);
+    screen_area_set_dirty(ge->help, FALSE);
+  }
 
-  /* Paint the in the feedback area */
+  /* Paint the in the feedback area, which changes with every command */
   screen_area_clear(ge->feedback);
 
+  layout_puts(ge->line, "\033[0;32;42m~\033[0m");
   if(game_get_new_command(game)!=NO_CMD) {
-    strncpy(obj, dialogue_text(game_get_new_command(game),game), WORD_SIZE);
-    sprintf(str, "\033[0;32;42m~\033[0m\033[0;37;40m %s\033[0m", obj);
-    gaps=182-strlen(obj)-2;
-    sprintf(str+strlen(str), "\033[0;30;40m ");
-    for (i=0; i<gaps-2; i++) {
-      sprintf(str+strlen(str), " ");
-    }
-    sprintf(str+strlen(str), "\033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->feedback, str);
-  }
-  else {
-    sprintf(str, "\033[0;32;42m~\033[0m\033[0;30;40m                                                                                                                                                                                    \033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->feedback, str);
+    layout_puts(ge->line, "\033[0;37;40m ");
+    layout_puts(ge->line, dialogue_text(game_get_new_command(game),game));
+    layout_puts(ge->line, "\033[0m");
   }
+  graphic_engine_text_line_print(ge, ge->feedback);
 
+  layout_puts(ge->line, "\033[0;32;42m~\033[0m");
   if(game_get_game_run_rules(game)==RULE) {
-    strncpy(rules_string, game_get_rules_string(game), WORD_SIZE);
-    sprintf(str, "\033[0;32;42m~\033[0m\033[0;37;40m %s\033[0m", rules_string);
-    gaps=182-strlen(rules_string)-2;
-    sprintf(str+strlen(str), "\033[0;30;40m ");
-    for (i=0; i<gaps-2; i++) {
-      sprintf(str+strlen(str), " ");
-    }
-    sprintf(str+strlen(str), "\033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->feedback, str);
-  }
-  else {
-    sprintf(str, "\033[0;32;42m~\033[0m\033[0;30;40m                                                                                                                                                                                    \033[0m\033[0;32;42m~\033[0m");
-    screen_area_puts(ge->feedback, str);
+    layout_puts(ge->line, "\033[0;37;40m ");
+    layout_puts(ge->line, game_get_rules_string(game));
+    layout_puts(ge->line, "\033[0m");
   }
+  graphic_engine_text_line_print(ge, ge->feedback);
+}
 
-  /* Dump to the terminal */
+/**
+ * @brief Terminal backend: ANSI frames on the standard output
+ */
+STATUS graphic_engine_terminal_open(Graphic_engine *ge, const char *file) {
+  screen_init();
+  /* Nothing is buffered by stdio, so every frame costs the one write done by screen_paint() */
+  setvbuf(stdout, NULL, _IONBF, 0);
+  return OK;
+}
+
+void graphic_engine_terminal_paint(Graphic_engine *ge, Game *game) {
+  graphic_engine_compose(ge, game);
+
+  /* Dump to the terminal, prompt included */
   screen_paint(ge->banner, ge->map, ge->descript, ge->help, ge->feedback);
-  printf("prompt:> ");
+}
+
+void graphic_engine_terminal_close(Graphic_engine *ge) {
+  screen_destroy();
+}
+
+/**
+ * @brief Null backend: no frame is composed nor painted
+ */
+STATUS graphic_engine_null_open(Graphic_engine *ge, const char *file) {
+  return OK;
+}
+
+void graphic_engine_null_paint(Graphic_engine *ge, Game *game) {
+}
+
+void graphic_engine_null_close(Graphic_engine *ge) {
+}
+
+/**
+ * @brief Snapshot backend: plain text frames on a file
+ */
+STATUS graphic_engine_snapshot_open(Graphic_engine *ge, const char *file) {
+  if (!file)
+    return ERROR;
+  if ((ge->snapshot = fopen(file, "w")) == NULL)
+    return ERROR;
+  screen_init();
+  return OK;
+}
+
+void graphic_engine_snapshot_paint(Graphic_engine *ge, Game *game) {
+  graphic_engine_compose(ge, game);
+  screen_snapshot(ge->snapshot, ge->banner, ge->map, ge->descript, ge->help, ge->feedback);
+}
+
+void graphic_engine_snapshot_close(Graphic_engine *ge) {
+  if (ge->snapshot)
+    fclose(ge->snapshot);
+  ge->snapshot = NULL;
+  ge->map_id = NO_ID;
+  ge->map_version = -1;
+  ge->descript_id = NO_ID;
+  ge->descript_version = -1;
+  screen_destroy();
 }
@@ -0,0 +1,236 @@
+/**
+ * @brief Defines a table from identifiers to positions (id_table)
+ *
+ * @file id_table.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "id_table.h"
+
+#define ID_TABLE_INIT_SLOTS 16   /*!< Slots made at least when the table is built */
+#define ID_TABLE_DENSITY 4       /*!< Slots for each identifier the array may take before a hash table is used */
+
+/**
+ * @brief Table of identifiers
+ *
+ * This structure keeps every identifier with its position and, to look for them, an
+ * array of slots: indexed by the identifier minus base when direct is TRUE, or a hash
+ * table with linear probing otherwise. Each slot has an entry, NO_ENTRY if empty.
+ */
+struct _Id_table {
+  Id *id;              /*!< Identifier of every entry */
+  int *position;       /*!< Position of every entry */
+  int n_ids;           /*!< Number of entries */
+  int max_ids;         /*!< Room for entries before growing */
+  int *slot;           /*!< Entry of every slot, NO_ENTRY if empty */
+  int n_slots;         /*!< Number of slots, a power of two if it is a hash table */
+  Id base;             /*!< Identifier of the first slot if direct */
+  BOOL direct;         /*!< TRUE if the slots are indexed by the identifier */
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Looks for the slot of an identifier.
+ * @param table pointer to the table.
+ * @param id identifier.
+ * @return slot holding the identifier or, if it is not there, the empty slot it
+ * would take, -1 if it does not fit in the slots.
+ */
+int id_table_utils_slot(Id_table* table, Id id);
+
+/**
+ * @brief Makes the slots again for the entries of the table, choosing an array
+ * if the identifiers are close and a hash table if not. An array has room below
+ * the lowest identifier and above the highest, so adding identifiers in any order
+ * only makes the slots again when the range has grown by half.
+ * @param table pointer to the table.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS id_table_utils_build(Id_table* table);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
+Id_table* id_table_create() {
+  Id_table *table = NULL;
+
+  table = (Id_table *) malloc(sizeof(Id_table));
+  if (!table)
+    return NULL;
+
+  table->id = NULL;
+  table->position = NULL;
+  table->n_ids = 0;
+  table->max_ids = 0;
+  table->slot = NULL;
+  table->n_slots = 0;
+  table->base = 0;
+  table->direct = TRUE;
+
+  return table;
+}
+
+void id_table_destroy(Id_table* table) {
+  if (!table)
+    return;
+
+  free(table->id);
+  free(table->position);
+  free(table->slot);
+  free(table);
+}
+
+STATUS id_table_clear(Id_table* table) {
+  int s;
+
+  if (!table)
+    return ERROR;
+
+  for (s=0; s<table->n_slots; s++)
+    table->slot[s] = NO_ENTRY;
+  table->n_ids = 0;
+
+  return OK;
+}
+
+STATUS id_table_add(Id_table* table, Id id, int position) {
+  Id *ids = NULL;
+  int *positions = NULL;
+  int s, max;
+
+  if (!table || id == NO_ID || position < 0)
+    return ERROR;
+
+  s = id_table_utils_slot(table, id);
+  if (s >= 0 && table->slot[s] != NO_ENTRY)
+    return OK;
+
+  if (table->n_ids == table->max_ids) {
+    max = table->max_ids ? 2*table->max_ids : ID_TABLE_INIT_SLOTS;
+    ids = (Id *) realloc(table->id, max*sizeof(Id));
+    if (!ids)
+      return ERROR;
+    table->id = ids;
+    positions = (int *) realloc(table->position, max*sizeof(int));
+    if (!positions)
+      return ERROR;
+    table->position = positions;
+    table->max_ids = max;
+  }
+  table->id[table->n_ids] = id;
+  table->position[table->n_ids] = position;
+  table->n_ids++;
+
+  /* A hash table is kept at most half full */
+  if (s < 0 || (table->direct == FALSE && 2*table->n_ids > table->n_slots))
+    return id_table_utils_build(table);
+
+  table->slot[s] = table->n_ids-1;
+  return OK;
+}
+
+int id_table_find(Id_table* table, Id id) {
+  int s;
+
+  if (!table || id == NO_ID)
+    return NO_ENTRY;
+
+  s = id_table_utils_slot(table, id);
+  if (s < 0 || table->slot[s] == NO_ENTRY)
+    return NO_ENTRY;
+  return table->position[table->slot[s]];
+}
+
+BOOL id_table_is_direct(Id_table* table) {
+  if (!table)
+    return FALSE;
+  return table->direct;
+}
+
+int id_table_get_number_of_ids(Id_table* table) {
+  if (!table)
+    return -1;
+  return table->n_ids;
+}
+
+int id_table_utils_slot(Id_table* table, Id id) {
+  unsigned long offset;
+  int s, mask = table->n_slots-1;
+
+  if (table->n_slots == 0)
+    return -1;
+
+  if (table->direct == TRUE) {
+    offset = (unsigned long) id - (unsigned long) table->base;
+    if (id < table->base || offset >= (unsigned long) table->n_slots)
+      return -1;
+    return (int) offset;
+  }
+
+  /* Linear probing until the identifier or an empty slot */
+  for (s = (int)((unsigned long)id*2654435761UL & mask); table->slot[s] != NO_ENTRY; s = (s+1) & mask) {
+    if (table->id[table->slot[s]] == id)
+      break;
+  }
+
+  return s;
+}
+
+STATUS id_table_utils_build(Id_table* table) {
+  int *slot = NULL;
+  Id min, max, base;
+  unsigned long range, below;
+  BOOL direct;
+  int e, s, n_slots;
+
+  min = max = table->id[0];
+  for (e=1; e<table->n_ids; e++) {
+    if (table->id[e] < min)
+      min = table->id[e];
+    if (table->id[e] > max)
+      max = table->id[e];
+  }
+  /* The range of every identifier there is does not fit in an unsigned long, and wraps to 0 */
+  range = (unsigned long) max - (unsigned long) min + 1;
+
+  /* Close identifiers get an array twice their range, centred on it, so the next
+     ones still fit whether they go up or down */
+  base = min;
+  if (range > 0 && range <= (unsigned long) ID_TABLE_DENSITY*table->n_ids) {
+    n_slots = (int) (2*range > ID_TABLE_INIT_SLOTS ? 2*range : ID_TABLE_INIT_SLOTS);
+    below = ((unsigned long) n_slots - range) / 2;
+    base = ((unsigned long) min - (unsigned long) LONG_MIN > below) ? min - (Id) below : LONG_MIN;
+    direct = TRUE;
+  } else {
+    for (n_slots = ID_TABLE_INIT_SLOTS; n_slots < ID_TABLE_DENSITY*table->n_ids; n_slots *= 2);
+    direct = FALSE;
+  }
+
+  /* If there is no memory the entry just added is dropped and the old slots are kept */
+  slot = (int *) malloc(n_slots*sizeof(int));
+  if (!slot) {
+    table->n_ids--;
+    return ERROR;
+  }
+  for (s=0; s<n_slots; s++)
+    slot[s] = NO_ENTRY;
+  free(table->slot);
+  table->slot = slot;
+  table->n_slots = n_slots;
+  table->direct = direct;
+  table->base = base;
+
+  for (e=0; e<table->n_ids; e++)
+    table->slot[id_table_utils_slot(table, table->id[e])] = e;
+
+  return OK;
+}
@@ -0,0 +1,172 @@
+/**
+ * @brief It tests id_table module
+ *
+ * @file id_table_test.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "id_table_test.h"
+#define MAX_TESTS 12
+
+/**
+ * @brief Main function to test id_table module.
+ *
+ * Two execution options:
+ *   1.-If no parameters, all test will run
+ *   2.-If you run with a number between 1 and the number of tests just run
+ *      the indicated test
+ *
+ */
+int main(int argc, char** argv) {
+
+    int test = 0;
+    int all = 1;
+
+    if (argc < 2) {
+        printf("Running all test for module id_table:\n");
+    } else {
+        test = atoi(argv[1]);
+        all = 0;
+        printf("Running test %d:\t", test);
+	if (test < 1 || test > MAX_TESTS) {
+	  printf("Error: unknown test %d\t", test);
+	  exit(EXIT_SUCCESS);
+        }
+    }
+
+
+    if (all || test == 1) test1_id_table_create();
+    if (all || test == 2) test1_id_table_add();
+    if (all || test == 3) test2_id_table_add();
+    if (all || test == 4) test3_id_table_add();
+    if (all || test == 5) test1_id_table_find();
+    if (all || test == 6) test2_id_table_find();
+    if (all || test == 7) test3_id_table_find();
+    if (all || test == 8) test1_id_table_is_direct();
+    if (all || test == 9) test2_id_table_is_direct();
+    if (all || test == 10) test1_id_table_clear();
+    if (all || test == 11) test4_id_table_find();
+    if (all || test == 12) test5_id_table_find();
+
+
+    PRINT_PASSED_PERCENTAGE;
+
+    return EXIT_SUCCESS;
+}
+
+void test1_id_table_create() {
+    Id_table *table = id_table_create();
+    PRINT_TEST_RESULT(table != NULL && id_table_find(table, 1) == NO_ENTRY && id_table_get_number_of_ids(table) == 0);
+    id_table_destroy(table);
+}
+
+void test1_id_table_add() {
+    Id_table *table = id_table_create();
+    PRINT_TEST_RESULT(id_table_add(table, 11, 0) == OK);
+    id_table_destroy(table);
+}
+
+void test2_id_table_add() {
+    Id_table *table = id_table_create();
+    PRINT_TEST_RESULT(id_table_add(NULL, 11, 0) == ERROR && id_table_add(table, NO_ID, 0) == ERROR && id_table_add(table, 11, -1) == ERROR);
+    id_table_destroy(table);
+}
+
+void test3_id_table_add() {
+    Id_table *table = id_table_create();
+    /* The first position of an identifier is kept */
+    id_table_add(table, 11, 0);
+    id_table_add(table, 11, 1);
+    PRINT_TEST_RESULT(id_table_find(table, 11) == 0 && id_table_get_number_of_ids(table) == 1);
+    id_table_destroy(table);
+}
+
+void test1_id_table_find() {
+    Id_table *table = id_table_create();
+    int i, found = 1;
+    for (i=0; i<1000; i++)
+        id_table_add(table, 11+i, i);
+    for (i=0; i<1000; i++) {
+        if (id_table_find(table, 11+i) != i)
+            found = 0;
+    }
+    PRINT_TEST_RESULT(found == 1 && id_table_find(table, 10) == NO_ENTRY && id_table_find(table, 1011) == NO_ENTRY);
+    id_table_destroy(table);
+}
+
+void test2_id_table_find() {
+    Id_table *table = id_table_create();
+    int i, found = 1;
+    for (i=0; i<1000; i++)
+        id_table_add(table, 7919L*i+1, i);
+    for (i=0; i<1000; i++) {
+        if (id_table_find(table, 7919L*i+1) != i)
+            found = 0;
+    }
+    PRINT_TEST_RESULT(found == 1 && id_table_find(table, 2) == NO_ENTRY);
+    id_table_destroy(table);
+}
+
+void test3_id_table_find() {
+    PRINT_TEST_RESULT(id_table_find(NULL, 1) == NO_ENTRY);
+}
+
+void test1_id_table_is_direct() {
+    Id_table *table = id_table_create();
+    int i;
+    for (i=100; i>0; i--)
+        id_table_add(table, i, i);
+    PRINT_TEST_RESULT(id_table_is_direct(table) == TRUE && id_table_find(table, 1) == 1);
+    id_table_destroy(table);
+}
+
+void test4_id_table_find() {
+    Id_table *table = id_table_create();
+    int i, found = 1;
+    /* Identifiers going down still fit in the array */
+    for (i=1000; i>0; i--)
+        id_table_add(table, i, 1000-i);
+    for (i=1000; i>0; i--) {
+        if (id_table_find(table, i) != 1000-i)
+            found = 0;
+    }
+    PRINT_TEST_RESULT(found && id_table_is_direct(table) == TRUE && id_table_find(table, 0) == NO_ENTRY && id_table_find(table, 1001) == NO_ENTRY);
+    id_table_destroy(table);
+}
+
+void test5_id_table_find() {
+    Id_table *table = id_table_create();
+    /* The lowest and highest identifiers there are, whose range does not fit in a long */
+    id_table_add(table, LONG_MIN+1, 0);
+    id_table_add(table, LONG_MIN, 1);
+    id_table_add(table, LONG_MAX, 2);
+    PRINT_TEST_RESULT(id_table_find(table, LONG_MIN+1) == 0 && id_table_find(table, LONG_MIN) == 1 && id_table_find(table, LONG_MAX) == 2 &&
+                      id_table_is_direct(table) == FALSE);
+    id_table_destroy(table);
+}
+
+void test2_id_table_is_direct() {
+    Id_table *table = id_table_create();
+    /* A far identifier turns the array into a hash table */
+    id_table_add(table, 1, 0);
+    id_table_add(table, 2, 1);
+    id_table_add(table, 1000000, 2);
+    PRINT_TEST_RESULT(id_table_is_direct(table) == FALSE && id_table_find(table, 2) == 1 && id_table_find(table, 1000000) == 2);
+    id_table_destroy(table);
+}
+
+void test1_id_table_clear() {
+    Id_table *table = id_table_create();
+    id_table_add(table, 11, 0);
+    id_table_clear(table);
+    id_table_add(table, 12, 3);
+    PRINT_TEST_RESULT(id_table_find(table, 11) == NO_ENTRY && id_table_find(table, 12) == 3 && id_table_get_number_of_ids(table) == 1);
+    id_table_destroy(table);
+}
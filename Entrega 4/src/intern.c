@@ -0,0 +1,231 @@
+/**
+ * @brief Defines a table of interned strings (intern)
+ *
+ * @file intern.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "intern.h"
+
+#define INTERN_INIT_STRINGS 64   /*!< Strings room is made for at first */
+#define INTERN_OWN_STRINGS 4     /*!< Strings room is made for at first in a table with its own arena */
+#define INTERN_CHUNK_SIZE 256    /*!< Bytes of every chunk of the arena of a table */
+
+/**
+ * @brief Table of strings
+ *
+ * This structure defines the strings of a game: names, descriptions and lines
+ * of graphic descriptions.
+ */
+struct _Intern {
+  char **strings;            /*!< String of every handle */
+  unsigned long *hashes;     /*!< Hash of every string */
+  int n_strings;             /*!< Number of strings */
+  int max_strings;           /*!< Room in strings and hashes */
+  int *table;                /*!< Hash table of handles, NO_STRING if empty */
+  int table_size;            /*!< Buckets of the table, a power of two */
+  Arena *arena;              /*!< Arena the strings are copied to */
+  BOOL own_arena;            /*!< TRUE if the arena belongs to the table */
+  long size;                 /*!< Bytes taken by the strings */
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Hash of a string (FNV-1a).
+ * @param str string.
+ * @param len length of the string.
+ * @return hash of the string.
+ */
+unsigned long intern_utils_hash(const char* str, int len);
+
+/**
+ * @brief Looks for the bucket of a string.
+ * @param intern pointer to the table.
+ * @param str string.
+ * @param hash hash of the string.
+ * @return bucket holding the string or, if it is not stored, the empty bucket it would take.
+ */
+int intern_utils_bucket(Intern* intern, const char* str, unsigned long hash);
+
+/**
+ * @brief Doubles the hash table when it is half full.
+ * @param intern pointer to the table.
+ * @return OK if there is room for one more string, ERROR otherwise.
+ */
+STATUS intern_utils_grow(Intern* intern);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
+Intern* intern_create(Arena* arena) {
+  Intern* intern = NULL;
+  int i, max_strings = INTERN_INIT_STRINGS;
+
+  intern = (Intern *) malloc(sizeof(Intern));
+  if (!intern)
+    return NULL;
+
+  intern->arena = arena;
+  intern->own_arena = FALSE;
+  if (!arena) {
+    /* A table of its own holds the few strings of a single entity, so it starts small */
+    intern->arena = arena_create_size(INTERN_CHUNK_SIZE);
+    intern->own_arena = TRUE;
+    max_strings = INTERN_OWN_STRINGS;
+  }
+  intern->strings = (char **) malloc(max_strings*sizeof(char *));
+  intern->hashes = (unsigned long *) malloc(max_strings*sizeof(unsigned long));
+  intern->table = (int *) malloc(2*max_strings*sizeof(int));
+  if (!intern->strings || !intern->hashes || !intern->table || !intern->arena) {
+    intern_destroy(intern);
+    return NULL;
+  }
+  intern->n_strings = 0;
+  intern->max_strings = max_strings;
+  intern->table_size = 2*max_strings;
+  for (i=0; i<intern->table_size; i++)
+    intern->table[i] = NO_STRING;
+  intern->size = 0;
+
+  return intern;
+}
+
+void intern_destroy(Intern* intern) {
+  if (!intern)
+    return;
+
+  if (intern->own_arena == TRUE)
+    arena_destroy(intern->arena);
+  if (intern->strings)
+    free(intern->strings);
+  if (intern->hashes)
+    free(intern->hashes);
+  if (intern->table)
+    free(intern->table);
+  free(intern);
+}
+
+int intern_put(Intern* intern, const char* str) {
+  unsigned long hash;
+  int len, i;
+
+  if (!intern || !str || str[0] == '\0')
+    return NO_STRING;
+
+  len = strlen(str);
+  hash = intern_utils_hash(str, len);
+  i = intern_utils_bucket(intern, str, hash);
+  if (intern->table[i] != NO_STRING)
+    return intern->table[i];
+
+  if (intern_utils_grow(intern) == ERROR)
+    return NO_STRING;
+  if ((intern->strings[intern->n_strings] = arena_strdup(intern->arena, str)) == NULL)
+    return NO_STRING;
+  intern->size += len+1;
+  intern->hashes[intern->n_strings] = hash;
+
+  /* The table may have grown, so the bucket is looked for again */
+  intern->table[intern_utils_bucket(intern, str, hash)] = intern->n_strings;
+
+  return intern->n_strings++;
+}
+
+int intern_find(Intern* intern, const char* str) {
+  if (!intern || !str || str[0] == '\0')
+    return NO_STRING;
+
+  return intern->table[intern_utils_bucket(intern, str, intern_utils_hash(str, strlen(str)))];
+}
+
+const char* intern_get(Intern* intern, int handle) {
+  if (!intern)
+    return NULL;
+  if (handle == NO_STRING)
+    return "";
+  if (handle < 0 || handle >= intern->n_strings)
+    return NULL;
+  return intern->strings[handle];
+}
+
+int intern_get_number_of_strings(Intern* intern) {
+  if (!intern)
+    return -1;
+  return intern->n_strings;
+}
+
+long intern_get_size(Intern* intern) {
+  if (!intern)
+    return -1;
+  return intern->size;
+}
+
+unsigned long intern_utils_hash(const char* str, int len) {
+  unsigned long hash = 2166136261UL;
+  int i;
+
+  for (i=0; i<len; i++) {
+    hash ^= (unsigned char) str[i];
+    hash *= 16777619UL;
+  }
+
+  return hash & 0xFFFFFFFFUL;
+}
+
+int intern_utils_bucket(Intern* intern, const char* str, unsigned long hash) {
+  int i, mask = intern->table_size-1;
+
+  /* Linear probing until the string or an empty bucket */
+  for (i = hash & mask; intern->table[i] != NO_STRING; i = (i+1) & mask) {
+    if (intern->hashes[intern->table[i]] == hash && strcmp(intern->strings[intern->table[i]], str) == 0)
+      break;
+  }
+
+  return i;
+}
+
+STATUS intern_utils_grow(Intern* intern) {
+  char **strings = NULL;
+  unsigned long *hashes = NULL;
+  int *table = NULL;
+  int i, j, size;
+
+  if (intern->n_strings < intern->max_strings)
+    return OK;
+
+  strings = (char **) realloc(intern->strings, 2*intern->max_strings*sizeof(char *));
+  if (!strings)
+    return ERROR;
+  intern->strings = strings;
+  hashes = (unsigned long *) realloc(intern->hashes, 2*intern->max_strings*sizeof(unsigned long));
+  if (!hashes)
+    return ERROR;
+  intern->hashes = hashes;
+
+  /* The table is kept at twice the strings, so it is never more than half full */
+  size = 2*intern->table_size;
+  table = (int *) malloc(size*sizeof(int));
+  if (!table)
+    return ERROR;
+  for (i=0; i<size; i++)
+    table[i] = NO_STRING;
+  for (i=0; i<intern->n_strings; i++) {
+    for (j = intern->hashes[i] & (size-1); table[j] != NO_STRING; j = (j+1) & (size-1));
+    table[j] = i;
+  }
+  free(intern->table);
+  intern->table = table;
+  intern->table_size = size;
+  intern->max_strings *= 2;
+
+  return OK;
+}
@@ -0,0 +1,147 @@
+/**
+ * @brief It tests intern module
+ *
+ * @file intern_test.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "intern_test.h"
+#define MAX_TESTS 11
+
+/**
+ * @brief Main function to test intern module.
+ *
+ * Two execution options:
+ *   1.-If no parameters, all test will run
+ *   2.-If you run with a number between 1 and the number of tests just run
+ *      the indicated test
+ *
+ */
+int main(int argc, char** argv) {
+
+    int test = 0;
+    int all = 1;
+
+    if (argc < 2) {
+        printf("Running all test for module intern:\n");
+    } else {
+        test = atoi(argv[1]);
+        all = 0;
+        printf("Running test %d:\t", test);
+	if (test < 1 || test > MAX_TESTS) {
+	  printf("Error: unknown test %d\t", test);
+	  exit(EXIT_SUCCESS);
+        }
+    }
+
+
+    if (all || test == 1) test1_intern_create();
+    if (all || test == 2) test1_intern_put();
+    if (all || test == 3) test2_intern_put();
+    if (all || test == 4) test3_intern_put();
+    if (all || test == 5) test4_intern_put();
+    if (all || test == 6) test1_intern_get();
+    if (all || test == 7) test2_intern_get();
+    if (all || test == 8) test3_intern_get();
+    if (all || test == 9) test1_intern_get_size();
+    if (all || test == 10) test1_intern_find();
+    if (all || test == 11) test2_intern_find();
+
+
+    PRINT_PASSED_PERCENTAGE;
+
+    return EXIT_SUCCESS;
+}
+
+void test1_intern_create() {
+    Intern *intern = intern_create(NULL);
+    PRINT_TEST_RESULT(intern != NULL && intern_get_number_of_strings(intern) == 0);
+    intern_destroy(intern);
+}
+
+void test1_intern_put() {
+    Intern *intern = intern_create(NULL);
+    PRINT_TEST_RESULT(intern_put(intern, "") == NO_STRING && intern_get_number_of_strings(intern) == 0);
+    intern_destroy(intern);
+}
+
+void test2_intern_put() {
+    Intern *intern = intern_create(NULL);
+    int a = intern_put(intern, "  /\\  ");
+    int b = intern_put(intern, " /  \\ ");
+    PRINT_TEST_RESULT(a != NO_STRING && b != NO_STRING && a != b);
+    intern_destroy(intern);
+}
+
+void test3_intern_put() {
+    Intern *intern = intern_create(NULL);
+    char line[16] = "  /\\  ";
+    int a = intern_put(intern, "  /\\  ");
+    PRINT_TEST_RESULT(intern_put(intern, line) == a && intern_get_number_of_strings(intern) == 1);
+    intern_destroy(intern);
+}
+
+void test4_intern_put() {
+    Intern *intern = intern_create(NULL);
+    char line[16];
+    int i, ok = 1;
+    for (i = 0; i < 1000; i++) {
+        sprintf(line, "line %d", i);
+        if (intern_put(intern, line) != i)
+            ok = 0;
+    }
+    for (i = 0; i < 1000; i++) {
+        sprintf(line, "line %d", i);
+        if (intern_put(intern, line) != i)
+            ok = 0;
+    }
+    PRINT_TEST_RESULT(ok && intern_get_number_of_strings(intern) == 1000);
+    intern_destroy(intern);
+}
+
+void test1_intern_get() {
+    Intern *intern = intern_create(NULL);
+    int a = intern_put(intern, "~~~~");
+    PRINT_TEST_RESULT(strcmp(intern_get(intern, a), "~~~~") == 0);
+    intern_destroy(intern);
+}
+
+void test2_intern_get() {
+    Intern *intern = intern_create(NULL);
+    PRINT_TEST_RESULT(strcmp(intern_get(intern, NO_STRING), "") == 0 && intern_get(intern, 3) == NULL);
+    intern_destroy(intern);
+}
+
+void test3_intern_get() {
+    Intern *intern = NULL;
+    PRINT_TEST_RESULT(intern_get(intern, NO_STRING) == NULL);
+}
+
+void test1_intern_get_size() {
+    Intern *intern = intern_create(NULL);
+    intern_put(intern, "abc");
+    intern_put(intern, "abc");
+    intern_put(intern, "de");
+    PRINT_TEST_RESULT(intern_get_size(intern) == 7);
+    intern_destroy(intern);
+}
+
+void test1_intern_find() {
+    Intern *intern = intern_create(NULL);
+    int a = intern_put(intern, "llave");
+    PRINT_TEST_RESULT(intern_find(intern, "llave") == a && intern_get_number_of_strings(intern) == 1);
+    intern_destroy(intern);
+}
+
+void test2_intern_find() {
+    Intern *intern = intern_create(NULL);
+    intern_put(intern, "llave");
+    PRINT_TEST_RESULT(intern_find(intern, "linterna") == NO_STRING && intern_get_number_of_strings(intern) == 1);
+    intern_destroy(intern);
+}
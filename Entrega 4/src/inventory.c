@@ -9,28 +9,57 @@
 
  #include <stdlib.h>
  #include <stdio.h>
+ #include <string.h>
  #include "inventory.h"
 
  struct _Inventory{
-   Set* object;
-   int max_objects;
+   Id* object;         /*!< Objects carried, sorted by their identifier */
+   int n_objects;      /*!< Number of objects carried */
+   int max_objects;    /*!< Max number of objects, the size of the array */
+   Arena* arena;       /*!< Arena the inventory comes from, NULL for malloc() */
  };
 
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Looks for the position of an object in the inventory.
+ * @param inventory pointer to the inventory.
+ * @param id identifier of the object.
+ * @return position of the object or, if it is not there, the one it would take.
+ */
+int inventory_utils_find(Inventory* inventory, Id id);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
 Inventory* inventory_create(int maxobjects) {
+  return inventory_create_in(NULL, maxobjects);
+}
+
+Inventory* inventory_create_in(Arena* arena, int maxobjects) {
   Inventory* inventory = NULL;
 
-  inventory=(Inventory*)malloc(sizeof(Inventory));
+  inventory=(Inventory*)arena_alloc(arena, sizeof(Inventory));
 
   if(!inventory) {
     return NULL;
   }
 
-  inventory->object=set_create();
+  if (maxobjects < 0) {
+    maxobjects = 0;
+  }
+  inventory->arena=arena;
+  inventory->n_objects=0;
+  inventory->max_objects=maxobjects;
+  /* The array takes just the objects the player can carry, one more so it is never empty */
+  inventory->object=(Id*)arena_alloc(arena, (maxobjects+1)*sizeof(Id));
   if (inventory->object==NULL) {
-    inventory_destroy(inventory);
+    arena_free(arena, inventory);
     return NULL;
   }
-  inventory->max_objects=maxobjects;
 
   return inventory;
 }
@@ -39,30 +68,46 @@ STATUS inventory_destroy(Inventory* inventory){
   if(!inventory){
     return ERROR;
   }
-  if(set_destroy(inventory->object)==ERROR){
-    return ERROR;
-  }
 
-  free(inventory);
+  arena_free(inventory->arena, inventory->object);
+  arena_free(inventory->arena, inventory);
   inventory=NULL;
   return OK;
 }
 
 STATUS inventory_set_object(Inventory *inventory, Id id){
+  int pos;
+
   if(!inventory || id == NO_ID){
     return ERROR;
   }
-  if (inventory->max_objects <= set_get_num(inventory->object)){
+  pos=inventory_utils_find(inventory, id);
+  if (pos < inventory->n_objects && inventory->object[pos] == id){
+    return ERROR;
+  }
+  if (inventory->max_objects <= inventory->n_objects){
     return ERROR;
   }
-  return set_add(inventory->object, id);
+
+  memmove(inventory->object+pos+1, inventory->object+pos, (inventory->n_objects-pos)*sizeof(Id));
+  inventory->object[pos]=id;
+  inventory->n_objects++;
+  return OK;
 }
 
 Id inventory_get_object(Inventory *inventory, int index) {
-  if(!inventory){
+  if(!inventory || index < 0 || index >= inventory->n_objects){
     return NO_ID;
   }
-  return set_get(inventory->object, index);
+  return inventory->object[index];
+}
+
+const Id* inventory_get_objects(Inventory *inventory, int *n) {
+  if(!inventory || !n){
+    return NULL;
+  }
+  *n=inventory->n_objects;
+  return inventory->object;
 }
 
 int inventory_get_maxobjects(Inventory *inventory) {
@@ -73,22 +118,62 @@ int inventory_get_maxobjects(Inventory *inventory) {
 }
 
 STATUS inventory_del_object(Inventory *inventory, Id id) {
-  return set_del(inventory->object, id);
+  int pos;
+
+  if(!inventory || id == NO_ID){
+    return ERROR;
+  }
+  pos=inventory_utils_find(inventory, id);
+  if (pos >= inventory->n_objects || inventory->object[pos] != id){
+    return ERROR;
+  }
+
+  inventory->n_objects--;
+  memmove(inventory->object+pos, inventory->object+pos+1, (inventory->n_objects-pos)*sizeof(Id));
+  return OK;
 }
 
 BOOL inventory_has_object(Inventory* inventory, Id id) {
-  return set_has_id(inventory->object, id);
+  int pos;
+
+  if(!inventory || id == NO_ID){
+    return FALSE;
+  }
+  pos=inventory_utils_find(inventory, id);
+  if (pos < inventory->n_objects && inventory->object[pos] == id){
+    return TRUE;
+  }
+  return FALSE;
 }
 
 STATUS inventory_print(Inventory *inventory){
+  int i;
+
   if(!inventory){
     return ERROR;
   }
 
   fprintf(stdout, "--> Inventory max elements: %d",inventory->max_objects);
   fprintf(stdout, "--> Objects in inventory:\n");
-  if(set_print(inventory->object)==ERROR){
-    return ERROR;
+  for (i=0; i<inventory->n_objects; i++) {
+    fprintf(stdout, "    %ld\n", inventory->object[i]);
   }
+  fprintf(stdout, "    Number: %d)\n", inventory->n_objects);
   return OK;
 }
+
+int inventory_utils_find(Inventory* inventory, Id id) {
+  int low = 0, high = inventory->n_objects;
+  int mid;
+
+  /* Binary search of the first object not lower than id */
+  while (low < high) {
+    mid = (low + high) / 2;
+    if (inventory->object[mid] < id)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+
+  return low;
+}
@@ -14,7 +14,7 @@
 #include <string.h>
 #include "inventory_test.h"
 
-#define MAX_TESTS 12
+#define MAX_TESTS 15
 
 /**
  * @brief Main function to test inventory module.
@@ -59,6 +59,10 @@ int main(int argc, char** argv) {
     if (all || test == 11) test1_inventory_has_object();
     if (all || test == 12) test2_inventory_has_object();
 
+    if (all || test == 13) test4_inventory_set_object();
+    if (all || test == 14) test1_inventory_get_objects();
+    if (all || test == 15) test2_inventory_get_objects();
+
     PRINT_PASSED_PERCENTAGE;
 
     return EXIT_SUCCESS;
@@ -91,6 +95,14 @@ void test3_inventory_set_object(){
   PRINT_TEST_RESULT(inventory_set_object(i, -1)==ERROR);
 }
 
+void test4_inventory_set_object(){
+  Inventory *i;
+  i=inventory_create(2);
+  inventory_set_object(i, 1);
+  inventory_set_object(i, 2);
+  PRINT_TEST_RESULT(inventory_set_object(i, 3)==ERROR);
+}
+
 void test1_inventory_get_object(){
   Inventory *i;
   i=inventory_create(5);
@@ -138,3 +150,21 @@ void test3_inventory_has_object(){
   Inventory *i = NULL;
   PRINT_TEST_RESULT(inventory_del_object(i,1)==ERROR);
 }
+
+void test1_inventory_get_objects(){
+  Inventory *i = NULL;
+  int n = 0;
+  PRINT_TEST_RESULT(inventory_get_objects(i, &n)==NULL);
+}
+void test2_inventory_get_objects(){
+  Inventory *i;
+  const Id *objects;
+  int n = 0;
+  i=inventory_create(5);
+  inventory_set_object(i, 3);
+  inventory_set_object(i, 1);
+  inventory_set_object(i, 2);
+  inventory_del_object(i, 2);
+  objects=inventory_get_objects(i, &n);
+  PRINT_TEST_RESULT(n==2 && objects[0]==1 && objects[1]==3);
+}
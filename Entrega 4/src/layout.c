@@ -0,0 +1,227 @@
+/**
+ * @brief Defines a line layout (layout)
+ *
+ * @file layout.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "layout.h"
+
+/**
+ * @brief Layout
+ *
+ * This structure defines a line and the columns it takes.
+ */
+struct _Layout {
+  char *string;              /*!< Line */
+  int len;                   /*!< Bytes of the line, without the '\0' */
+  int size;                  /*!< Bytes allocated for string */
+  int width;                 /*!< Columns taken by the line */
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Makes room for more bytes.
+ * @param layout pointer to the layout.
+ * @param len bytes that are going to be appended.
+ * @return OK if there is room for them, ERROR otherwise.
+ */
+STATUS layout_utils_reserve(Layout* layout, int len);
+
+/**
+ * @brief Length of the control sequence at the start of a string.
+ * @param str string that may start with \033[.
+ * @return bytes of the sequence, 0 if str does not start with one.
+ */
+int layout_utils_escape_len(const char* str);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
+Layout* layout_create(int size) {
+  Layout* layout = NULL;
+
+  if (size < 1)
+    return NULL;
+
+  layout = (Layout *) malloc(sizeof(Layout));
+  if (!layout)
+    return NULL;
+
+  layout->string = (char *) malloc(size*sizeof(char));
+  if (!layout->string) {
+    free(layout);
+    return NULL;
+  }
+  layout->size = size;
+  layout_clear(layout);
+
+  return layout;
+}
+
+void layout_destroy(Layout* layout) {
+  if (!layout)
+    return;
+  if (layout->string)
+    free(layout->string);
+  free(layout);
+}
+
+void layout_clear(Layout* layout) {
+  if (!layout)
+    return;
+  layout->string[0] = '\0';
+  layout->len = 0;
+  layout->width = 0;
+}
+
+STATUS layout_puts(Layout* layout, const char* str) {
+  int len;
+
+  if (!layout || !str)
+    return ERROR;
+
+  len = strlen(str);
+  if (layout_utils_reserve(layout, len) == ERROR)
+    return ERROR;
+
+  memcpy(layout->string+layout->len, str, len+1);
+  layout->len += len;
+  layout->width += layout_width(str);
+
+  return OK;
+}
+
+STATUS layout_pad(Layout* layout, int column, char fill) {
+  int n;
+
+  if (!layout)
+    return ERROR;
+
+  n = column - layout->width;
+  if (n <= 0)
+    return OK;
+  if (layout_utils_reserve(layout, n) == ERROR)
+    return ERROR;
+
+  memset(layout->string+layout->len, fill, n);
+  layout->len += n;
+  layout->width += n;
+  layout->string[layout->len] = '\0';
+
+  return OK;
+}
+
+STATUS layout_fit(Layout* layout, const char* str, int width, BOOL right) {
+  int i, n, esc, start, taken = 0;
+  BOOL keep = TRUE;
+
+  if (!layout || !str || width < 0)
+    return ERROR;
+
+  start = layout->width;
+  if (right == TRUE) {
+    n = layout_width(str);
+    if (n < width && layout_pad(layout, start + width - n, ' ') == ERROR)
+      return ERROR;
+  }
+
+  n = strlen(str);
+  if (layout_utils_reserve(layout, n + width) == ERROR)
+    return ERROR;
+
+  /* Characters beyond width are dropped, control sequences are kept */
+  for (i=0; i<n; i++) {
+    if ((esc = layout_utils_escape_len(str+i)) > 0) {
+      memcpy(layout->string+layout->len, str+i, esc);
+      layout->len += esc;
+      i += esc-1;
+      continue;
+    }
+    /* Continuation bytes follow the fate of their leading byte */
+    if ((str[i] & 0xC0) != 0x80) {
+      keep = taken < width ? TRUE : FALSE;
+      if (keep == TRUE)
+        taken++;
+    }
+    if (keep == TRUE)
+      layout->string[layout->len++] = str[i];
+  }
+  layout->width += taken;
+  layout->string[layout->len] = '\0';
+
+  return layout_pad(layout, start + width, ' ');
+}
+
+char* layout_get_string(Layout* layout) {
+  if (!layout)
+    return NULL;
+  return layout->string;
+}
+
+int layout_get_width(Layout* layout) {
+  if (!layout)
+    return -1;
+  return layout->width;
+}
+
+int layout_width(const char* str) {
+  int i, esc, width = 0;
+
+  if (!str)
+    return -1;
+
+  for (i=0; str[i]!='\0'; i++) {
+    if ((esc = layout_utils_escape_len(str+i)) > 0) {
+      i += esc-1;
+      continue;
+    }
+    /* UTF-8 continuation bytes take no column */
+    if ((str[i] & 0xC0) != 0x80)
+      width++;
+  }
+
+  return width;
+}
+
+STATUS layout_utils_reserve(Layout* layout, int len) {
+  char *aux = NULL;
+  int size;
+
+  if (layout->len + len + 1 <= layout->size)
+    return OK;
+
+  size = layout->size;
+  while (layout->len + len + 1 > size)
+    size *= 2;
+  aux = (char *) realloc(layout->string, size*sizeof(char));
+  if (!aux)
+    return ERROR;
+  layout->string = aux;
+  layout->size = size;
+
+  return OK;
+}
+
+int layout_utils_escape_len(const char* str) {
+  int i;
+
+  if (str[0] != '\033' || str[1] != '[')
+    return 0;
+
+  /* Parameters up to the final byte, between @ and ~ */
+  for (i=2; str[i]!='\0' && (str[i] < 0x40 || str[i] > 0x7E); i++);
+  if (str[i] == '\0')
+    return i;
+
+  return i+1;
+}
@@ -0,0 +1,183 @@
+/**
+ * @brief It tests layout module
+ *
+ * @file layout_test.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "layout_test.h"
+#define MAX_TESTS 17
+
+/**
+ * @brief Main function to test layout module.
+ *
+ * Two execution options:
+ *   1.-If no parameters, all test will run
+ *   2.-If you run with a number between 1 and the number of tests just run
+ *      the indicated test
+ *
+ */
+int main(int argc, char** argv) {
+
+    int test = 0;
+    int all = 1;
+
+    if (argc < 2) {
+        printf("Running all test for module layout:\n");
+    } else {
+        test = atoi(argv[1]);
+        all = 0;
+        printf("Running test %d:\t", test);
+	if (test < 1 || test > MAX_TESTS) {
+	  printf("Error: unknown test %d\t", test);
+	  exit(EXIT_SUCCESS);
+        }
+    }
+
+
+    if (all || test == 1) test1_layout_create();
+    if (all || test == 2) test2_layout_create();
+
+    if (all || test == 3) test1_layout_puts();
+    if (all || test == 4) test2_layout_puts();
+    if (all || test == 5) test3_layout_puts();
+
+    if (all || test == 6) test1_layout_pad();
+    if (all || test == 7) test2_layout_pad();
+    if (all || test == 8) test3_layout_pad();
+
+    if (all || test == 9) test1_layout_fit();
+    if (all || test == 10) test2_layout_fit();
+    if (all || test == 11) test3_layout_fit();
+    if (all || test == 12) test4_layout_fit();
+
+    if (all || test == 13) test1_layout_width();
+    if (all || test == 14) test2_layout_width();
+    if (all || test == 15) test3_layout_width();
+
+    if (all || test == 16) test1_layout_clear();
+
+
+    PRINT_PASSED_PERCENTAGE;
+
+    return EXIT_SUCCESS;
+}
+
+void test1_layout_create() {
+    Layout *l;
+    l = layout_create(4);
+    PRINT_TEST_RESULT(l != NULL && layout_get_width(l) == 0);
+    layout_destroy(l);
+}
+
+void test2_layout_create() {
+    PRINT_TEST_RESULT(layout_create(0) == NULL);
+}
+
+void test1_layout_puts() {
+    Layout *l;
+    l = layout_create(4);
+    layout_puts(l, "hola ");
+    layout_puts(l, "mundo");
+    PRINT_TEST_RESULT(strcmp(layout_get_string(l), "hola mundo") == 0 && layout_get_width(l) == 10);
+    layout_destroy(l);
+}
+
+void test2_layout_puts() {
+    Layout *l;
+    l = layout_create(4);
+    layout_puts(l, "\033[0;30;40m ab");
+    PRINT_TEST_RESULT(layout_get_width(l) == 3);
+    layout_destroy(l);
+}
+
+void test3_layout_puts() {
+    Layout *l = NULL;
+    PRINT_TEST_RESULT(layout_puts(l, "hola") == ERROR);
+}
+
+void test1_layout_pad() {
+    Layout *l;
+    l = layout_create(4);
+    layout_puts(l, "ab");
+    layout_pad(l, 5, '-');
+    PRINT_TEST_RESULT(strcmp(layout_get_string(l), "ab---") == 0 && layout_get_width(l) == 5);
+    layout_destroy(l);
+}
+
+void test2_layout_pad() {
+    Layout *l;
+    l = layout_create(4);
+    layout_puts(l, "abcdef");
+    PRINT_TEST_RESULT(layout_pad(l, 3, ' ') == OK && strcmp(layout_get_string(l), "abcdef") == 0);
+    layout_destroy(l);
+}
+
+void test3_layout_pad() {
+    Layout *l;
+    l = layout_create(4);
+    layout_puts(l, "\033[1m|");
+    layout_pad(l, 3, ' ');
+    PRINT_TEST_RESULT(strcmp(layout_get_string(l), "\033[1m|  ") == 0);
+    layout_destroy(l);
+}
+
+void test1_layout_fit() {
+    Layout *l;
+    l = layout_create(4);
+    layout_fit(l, "ab", 4, FALSE);
+    layout_puts(l, "|");
+    PRINT_TEST_RESULT(strcmp(layout_get_string(l), "ab  |") == 0);
+    layout_destroy(l);
+}
+
+void test2_layout_fit() {
+    Layout *l;
+    l = layout_create(4);
+    layout_fit(l, "ab", 4, TRUE);
+    PRINT_TEST_RESULT(strcmp(layout_get_string(l), "  ab") == 0 && layout_get_width(l) == 4);
+    layout_destroy(l);
+}
+
+void test3_layout_fit() {
+    Layout *l;
+    l = layout_create(4);
+    layout_fit(l, "\033[31mabcdef\033[0m", 3, FALSE);
+    PRINT_TEST_RESULT(strcmp(layout_get_string(l), "\033[31mabc\033[0m") == 0 && layout_get_width(l) == 3);
+    layout_destroy(l);
+}
+
+void test4_layout_fit() {
+    Layout *l;
+    l = layout_create(4);
+    layout_fit(l, "a\xc3\xb1" "b", 2, FALSE);
+    PRINT_TEST_RESULT(strcmp(layout_get_string(l), "a\xc3\xb1") == 0 && layout_get_width(l) == 2);
+    layout_destroy(l);
+}
+
+void test1_layout_width() {
+    PRINT_TEST_RESULT(layout_width("\033[0m\033[0;32;42m~\033[0m") == 1);
+}
+
+void test2_layout_width() {
+    PRINT_TEST_RESULT(layout_width("\xc3\xa1rbol") == 5);
+}
+
+void test3_layout_width() {
+    PRINT_TEST_RESULT(layout_width(NULL) == -1);
+}
+
+void test1_layout_clear() {
+    Layout *l;
+    l = layout_create(4);
+    layout_puts(l, "hola");
+    layout_clear(l);
+    PRINT_TEST_RESULT(strcmp(layout_get_string(l), "") == 0 && layout_get_width(l) == 0);
+    layout_destroy(l);
+}
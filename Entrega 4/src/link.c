@@ -20,31 +20,43 @@
  */
 struct _Link {
   Id id;                      /*!<Links identifier */
-  char name[WORD_SIZE + 1];   /*!< Links name */
+  int name;                   /*!< Handle of the links name */
   Id north;                   /*!< North Space Identifier */
   Id south;                   /*!< South Space Identifier */
-  LINKSTATUS status;          /*!< Status of the link, open or close*/
+  LINKSTATUS own_status;      /*!< Status of the link, open or close, while it has no slot */
+  LINKSTATUS* status;         /*!< Where the status is kept, own_status or a slot of a graph */
+  Intern* strings;            /*!< Table of the name */
+  BOOL own_strings;           /*!< TRUE if the table belongs to the link */
+  Arena* arena;               /*!< Arena of the link, NULL if it comes from malloc() */
 };
 
 Link* link_create(Id id) {
+  return link_create_in(NULL, id);
+}
+
+Link* link_create_in(Arena* arena, Id id) {
 
   Link* link = NULL;
 
   if (id == NO_ID)
     return NULL;
 
-  link = (Link *) malloc(sizeof (Link));
+  link = (Link *) arena_alloc(arena, sizeof (Link));
 
   if (link == NULL) {
     return NULL;
   }
   link->id = id;
+  link->arena = arena;
 
-  link->name[0] = '\0';
+  link->name = NO_STRING;
+  link->strings = NULL;
+  link->own_strings = FALSE;
 
   link->north = NO_ID;
   link->south = NO_ID;
-  link->status = CLOSED;
+  link->own_status = CLOSED;
+  link->status = &link->own_status;
 
   return link;
 }
@@ -54,7 +66,9 @@ STATUS link_destroy(Link* link) {
     return ERROR;
   }
 
-  free(link);
+  if (link->own_strings == TRUE)
+    intern_destroy(link->strings);
+  arena_free(link->arena, link);
   link = NULL;
 
   return OK;
@@ -72,7 +86,15 @@ STATUS link_set_name(Link* link, char* name) {
     return ERROR;
   }
 
-  if (!strcpy(link->name, name)) {
+  if (!link->strings) {
+    /* Until the link is added to a game it keeps its name in a table of its own */
+    if ((link->strings = intern_create(NULL)) == NULL) {
+      return ERROR;
+    }
+    link->own_strings = TRUE;
+  }
+  link->name = intern_put(link->strings, name);
+  if (link->name == NO_STRING && name[0] != '\0') {
     return ERROR;
   }
 
@@ -83,9 +105,38 @@ const char * link_get_name(Link* link) {
   if (!link) {
     return NULL;
   }
+  if (!link->strings) {
+    return "";
+  }
+  return intern_get(link->strings, link->name);
+}
+
+int link_get_name_handle(Link* link) {
+  if (!link) {
+    return NO_STRING;
+  }
   return link->name;
 }
 
+STATUS link_set_intern(Link* link, Intern* strings) {
+  if (!link || !strings) {
+    return ERROR;
+  }
+  if (link->strings == strings) {
+    return OK;
+  }
+
+  if (link->strings) {
+    link->name = intern_put(strings, intern_get(link->strings, link->name));
+    if (link->own_strings == TRUE)
+      intern_destroy(link->strings);
+  }
+  link->strings = strings;
+  link->own_strings = FALSE;
+
+  return OK;
+}
+
 STATUS link_set_north(Link* link, Id id) {
   if (!link || id == NO_ID) {
     return ERROR;
@@ -131,14 +182,27 @@ STATUS link_set_status(Link* link, LINKSTATUS status) {
   if (!link) {
     return ERROR;
   }
-  link->status=status;
+  *link->status=status;
   return OK;
 }
 
 LINKSTATUS link_get_status(Link* link) {
   if (!link)
     return CLOSED;
-  return link->status;
+  return *link->status;
+}
+
+STATUS link_set_status_slot(Link* link, LINKSTATUS* slot) {
+  if (!link) {
+    return ERROR;
+  }
+
+  if (!slot)
+    slot = &link->own_status;
+  *slot = *link->status;
+  link->status = slot;
+
+  return OK;
 }
 
 STATUS link_print(Link* link) {
@@ -148,7 +212,7 @@ STATUS link_print(Link* link) {
     return ERROR;
   }
 
-  fprintf(stdout, "--> Link (Id: %ld; Name: %s)\n", link->id, link->name);
+  fprintf(stdout, "--> Link (Id: %ld; Name: %s)\n", link->id, link_get_name(link));
 
   idaux = link_get_north(link);
   if (NO_ID != idaux) {
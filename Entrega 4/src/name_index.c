@@ -0,0 +1,216 @@
+/**
+ * @brief Defines an index of entities by their name (name_index)
+ *
+ * @file name_index.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "name_index.h"
+
+#define NO_ENTRY -1   /*!< Empty bucket */
+
+/**
+ * @brief Index of names
+ *
+ * This structure defines a hash table from the name of an entity to the entity.
+ */
+struct _Name_index {
+  const char **name;     /*!< Name of every entry */
+  void **entity;         /*!< Entity of every entry */
+  int n_names;           /*!< Number of entries */
+  int *bucket;           /*!< Hash table of entries, NO_ENTRY if empty */
+  int n_buckets;         /*!< Buckets of the table, a power of two */
+  BOOL ignore_case;      /*!< TRUE if the case of the names does not matter */
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Hash of a name (FNV-1a), folding its case if the index ignores it.
+ * @param index pointer to the index.
+ * @param name name.
+ * @return hash of the name.
+ */
+unsigned long name_index_utils_hash(Name_index* index, const char* name);
+
+/**
+ * @brief Compares two names the way the index does.
+ * @param index pointer to the index.
+ * @param a first name.
+ * @param b second name.
+ * @return TRUE if they are the same name, FALSE otherwise.
+ */
+BOOL name_index_utils_equal(Name_index* index, const char* a, const char* b);
+
+/**
+ * @brief Looks for the bucket of a name.
+ * @param index pointer to the index.
+ * @param name name.
+ * @return bucket holding the name or, if it is not there, the empty bucket it would take.
+ */
+int name_index_utils_bucket(Name_index* index, const char* name);
+
+/**
+ * @brief Makes room for one more entry, doubling the table when it is half full.
+ * @param index pointer to the index.
+ * @return OK if there is room for one more entry, ERROR otherwise.
+ */
+STATUS name_index_utils_grow(Name_index* index);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
+Name_index* name_index_create(BOOL ignore_case) {
+  Name_index *index = NULL;
+
+  index = (Name_index *) malloc(sizeof(Name_index));
+  if (!index)
+    return NULL;
+
+  index->name = NULL;
+  index->entity = NULL;
+  index->n_names = 0;
+  index->bucket = NULL;
+  index->n_buckets = 0;
+  index->ignore_case = ignore_case;
+
+  return index;
+}
+
+void name_index_destroy(Name_index* index) {
+  if (!index)
+    return;
+
+  free(index->name);
+  free(index->entity);
+  free(index->bucket);
+  free(index);
+}
+
+STATUS name_index_clear(Name_index* index) {
+  int i;
+
+  if (!index)
+    return ERROR;
+
+  for (i=0; i<index->n_buckets; i++)
+    index->bucket[i] = NO_ENTRY;
+  index->n_names = 0;
+
+  return OK;
+}
+
+STATUS name_index_add(Name_index* index, const char* name, void* entity) {
+  int b;
+
+  if (!index || !name || !entity || name_index_utils_grow(index) == ERROR)
+    return ERROR;
+
+  b = name_index_utils_bucket(index, name);
+  if (index->bucket[b] != NO_ENTRY)
+    return OK;
+
+  index->name[index->n_names] = name;
+  index->entity[index->n_names] = entity;
+  index->bucket[b] = index->n_names++;
+
+  return OK;
+}
+
+void* name_index_find(Name_index* index, const char* name) {
+  int b;
+
+  if (!index || !name || index->n_names == 0)
+    return NULL;
+
+  b = name_index_utils_bucket(index, name);
+  if (index->bucket[b] == NO_ENTRY)
+    return NULL;
+  return index->entity[index->bucket[b]];
+}
+
+int name_index_get_number_of_names(Name_index* index) {
+  if (!index)
+    return -1;
+  return index->n_names;
+}
+
+unsigned long name_index_utils_hash(Name_index* index, const char* name) {
+  unsigned long hash = 2166136261UL;
+
+  for (; *name; name++) {
+    if (index->ignore_case == TRUE)
+      hash ^= (unsigned char) tolower((unsigned char) *name);
+    else
+      hash ^= (unsigned char) *name;
+    hash = (hash * 16777619UL) & 0xffffffffUL;
+  }
+
+  return hash;
+}
+
+BOOL name_index_utils_equal(Name_index* index, const char* a, const char* b) {
+  if (index->ignore_case == FALSE)
+    return strcmp(a, b) == 0 ? TRUE : FALSE;
+
+  for (; *a && tolower((unsigned char) *a) == tolower((unsigned char) *b); a++, b++);
+
+  return tolower((unsigned char) *a) == tolower((unsigned char) *b) ? TRUE : FALSE;
+}
+
+int name_index_utils_bucket(Name_index* index, const char* name) {
+  int b, mask = index->n_buckets-1;
+
+  /* Linear probing until the name or an empty bucket */
+  for (b = (int)(name_index_utils_hash(index, name) & mask); index->bucket[b] != NO_ENTRY; b = (b+1) & mask) {
+    if (name_index_utils_equal(index, index->name[index->bucket[b]], name) == TRUE)
+      break;
+  }
+
+  return b;
+}
+
+STATUS name_index_utils_grow(Name_index* index) {
+  const char **name = NULL;
+  void **entity = NULL;
+  int *bucket = NULL;
+  int i, b, n_buckets;
+
+  /* The table is kept at twice the entries, so it is never more than half full */
+  if (2*(index->n_names+1) <= index->n_buckets)
+    return OK;
+
+  n_buckets = index->n_buckets ? 2*index->n_buckets : 16;
+  name = (const char **) realloc((void *) index->name, (n_buckets/2)*sizeof(const char *));
+  if (!name)
+    return ERROR;
+  index->name = name;
+  entity = (void **) realloc(index->entity, (n_buckets/2)*sizeof(void *));
+  if (!entity)
+    return ERROR;
+  index->entity = entity;
+  bucket = (int *) malloc(n_buckets*sizeof(int));
+  if (!bucket)
+    return ERROR;
+
+  for (i=0; i<n_buckets; i++)
+    bucket[i] = NO_ENTRY;
+  free(index->bucket);
+  index->bucket = bucket;
+  index->n_buckets = n_buckets;
+  for (i=0; i<index->n_names; i++) {
+    b = name_index_utils_bucket(index, index->name[i]);
+    bucket[b] = i;
+  }
+
+  return OK;
+}
@@ -0,0 +1,146 @@
+/**
+ * @brief It tests name_index module
+ *
+ * @file name_index_test.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "name_index_test.h"
+#define MAX_TESTS 10
+
+/**
+ * @brief Entities indexed by the tests
+ */
+static int entities[3];
+
+/**
+ * @brief Main function to test name_index module.
+ *
+ * Two execution options:
+ *   1.-If no parameters, all test will run
+ *   2.-If you run with a number between 1 and the number of tests just run
+ *      the indicated test
+ *
+ */
+int main(int argc, char** argv) {
+
+    int test = 0;
+    int all = 1;
+
+    if (argc < 2) {
+        printf("Running all test for module name_index:\n");
+    } else {
+        test = atoi(argv[1]);
+        all = 0;
+        printf("Running test %d:\t", test);
+	if (test < 1 || test > MAX_TESTS) {
+	  printf("Error: unknown test %d\t", test);
+	  exit(EXIT_SUCCESS);
+        }
+    }
+
+
+    if (all || test == 1) test1_name_index_create();
+    if (all || test == 2) test1_name_index_add();
+    if (all || test == 3) test2_name_index_add();
+    if (all || test == 4) test3_name_index_add();
+    if (all || test == 5) test1_name_index_find();
+    if (all || test == 6) test2_name_index_find();
+    if (all || test == 7) test3_name_index_find();
+    if (all || test == 8) test4_name_index_find();
+    if (all || test == 9) test1_name_index_clear();
+    if (all || test == 10) test1_name_index_get_number_of_names();
+
+
+    PRINT_PASSED_PERCENTAGE;
+
+    return EXIT_SUCCESS;
+}
+
+void test1_name_index_create() {
+    Name_index *index = name_index_create(FALSE);
+    PRINT_TEST_RESULT(index != NULL && name_index_find(index, "key") == NULL);
+    name_index_destroy(index);
+}
+
+void test1_name_index_add() {
+    Name_index *index = name_index_create(FALSE);
+    PRINT_TEST_RESULT(name_index_add(index, "key", &entities[0]) == OK);
+    name_index_destroy(index);
+}
+
+void test2_name_index_add() {
+    PRINT_TEST_RESULT(name_index_add(NULL, "key", &entities[0]) == ERROR);
+}
+
+void test3_name_index_add() {
+    Name_index *index = name_index_create(FALSE);
+    /* The first entity with a name keeps it */
+    name_index_add(index, "key", &entities[0]);
+    name_index_add(index, "key", &entities[1]);
+    PRINT_TEST_RESULT(name_index_find(index, "key") == &entities[0]);
+    name_index_destroy(index);
+}
+
+void test1_name_index_find() {
+    Name_index *index = name_index_create(FALSE);
+    name_index_add(index, "key", &entities[0]);
+    name_index_add(index, "lantern", &entities[1]);
+    name_index_add(index, "", &entities[2]);
+    PRINT_TEST_RESULT(name_index_find(index, "lantern") == &entities[1] && name_index_find(index, "") == &entities[2]);
+    name_index_destroy(index);
+}
+
+void test2_name_index_find() {
+    Name_index *index = name_index_create(FALSE);
+    name_index_add(index, "key", &entities[0]);
+    PRINT_TEST_RESULT(name_index_find(index, "Key") == NULL && name_index_find(index, "keys") == NULL);
+    name_index_destroy(index);
+}
+
+void test3_name_index_find() {
+    Name_index *index = name_index_create(TRUE);
+    name_index_add(index, "Lantern", &entities[0]);
+    PRINT_TEST_RESULT(name_index_find(index, "lantern") == &entities[0] && name_index_find(index, "LANTERN") == &entities[0]);
+    name_index_destroy(index);
+}
+
+void test4_name_index_find() {
+    Name_index *index = name_index_create(FALSE);
+    char name[200][8];
+    int i, found = 1;
+    /* Enough names to make the table grow several times */
+    for (i=0; i<200; i++) {
+        sprintf(name[i], "n%d", i);
+        name_index_add(index, name[i], &entities[i%3]);
+    }
+    for (i=0; i<200; i++) {
+        if (name_index_find(index, name[i]) != &entities[i%3])
+            found = 0;
+    }
+    PRINT_TEST_RESULT(found == 1 && name_index_get_number_of_names(index) == 200);
+    name_index_destroy(index);
+}
+
+void test1_name_index_clear() {
+    Name_index *index = name_index_create(FALSE);
+    name_index_add(index, "key", &entities[0]);
+    name_index_clear(index);
+    PRINT_TEST_RESULT(name_index_find(index, "key") == NULL && name_index_get_number_of_names(index) == 0);
+    name_index_destroy(index);
+}
+
+void test1_name_index_get_number_of_names() {
+    Name_index *index = name_index_create(FALSE);
+    name_index_add(index, "key", &entities[0]);
+    name_index_add(index, "key", &entities[1]);
+    name_index_add(index, "lantern", &entities[1]);
+    PRINT_TEST_RESULT(name_index_get_number_of_names(index) == 2 && name_index_get_number_of_names(NULL) == -1);
+    name_index_destroy(index);
+}
@@ -19,34 +19,81 @@
 */
 struct _Object {
   Id id;                                 /*!< Object's identifier*/
-  char name[WORD_SIZE + 1];              /*!< Object's name */
-  char description[WORD_SIZE +1];        /*!< Object's description */
-  char full_description[WORD_SIZE +1];   /*!< Object's full description */
-  BOOL movable;                          /*!< Tells if the player can take the object*/
-  BOOL moved;                            /*!< Tells if the object has been moved */
-  BOOL hidden;                           /*!< Tells if the object is hidden */
-  Id open;                               /*!< Tells if the object can open a link */
-  BOOL illuminate;                       /*!< Tells if the object can illuminate a space */
-  BOOL turnedon;                         /*!< Indicates if an object which can illuminates is turned on */
+  int name;                              /*!< Handle of the object's name */
+  int description;                       /*!< Handle of the object's description */
+  int full_description;                  /*!< Handle of the object's full description */
+  Object_table* table;                   /*!< Table with the flags of the object and the link it opens */
+  int row;                               /*!< Row of the object in its table */
+  BOOL own_table;                        /*!< TRUE if the table belongs to the object */
+  Intern* strings;                       /*!< Table of the strings of the object */
+  BOOL own_strings;                      /*!< TRUE if the table belongs to the object */
+  Arena* arena;                          /*!< Arena of the object, NULL if it comes from malloc() */
 };
 
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Stores a string of the object.
+ * @param object pointer to the object.
+ * @param str string.
+ * @param handle where the handle of the string is written.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS object_utils_put(Object* object, const char* str, int* handle);
+
+/**
+ * @brief Gets a string of the object.
+ * @param object pointer to the object.
+ * @param handle handle of the string.
+ * @return the string.
+ */
+const char* object_utils_get(Object* object, int handle);
+
+/**
+ * @brief Gets the row of the object, making one if it has none yet.
+ * @param object pointer to the object.
+ * @return row of the object, NO_ROW if ERROR.
+ */
+int object_utils_row(Object* object);
+
+/**
+ * @brief Sets a flag of the object.
+ * @param object pointer to the object.
+ * @param flag flag to set.
+ * @param value new value of the flag.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS object_utils_set_flag(Object* object, OBJECT_FLAG flag, BOOL value);
+
 Object* object_create(Id id) {
+  return object_create_in(NULL, id);
+}
+
+Object* object_create_in(Arena* arena, Id id) {
 
   Object *object = NULL;
 
   if (id == NO_ID)
     return NULL;
 
-  object = (Object*) malloc(sizeof (Object));
+  object = (Object*) arena_alloc(arena, sizeof (Object));
 
   if (object == NULL) {
     return NULL;
   }
   object->id = id;
+  object->arena = arena;
 
-  object->name[0] = '\0';
-  object->description[0]= '\0';
-  object->full_description[0]= '\0';
+  object->name = NO_STRING;
+  object->description = NO_STRING;
+  object->full_description = NO_STRING;
+  object->strings = NULL;
+  object->own_strings = FALSE;
+  object->table = NULL;
+  object->row = NO_ROW;
+  object->own_table = FALSE;
 
   return object;
 }
@@ -56,7 +103,11 @@ STATUS object_destroy(Object* object) {
     return ERROR;
   }
 
-  free(object);
+  if (object->own_strings == TRUE)
+    intern_destroy(object->strings);
+  if (object->own_table == TRUE)
+    object_table_destroy(object->table);
+  arena_free(object->arena, object);
   object = NULL;
 
   return OK;
@@ -67,7 +118,7 @@ STATUS object_set_name(Object* object, char* name) {
     return ERROR;
   }
 
-  if (!strcpy(object->name, name)) {
+  if (object_utils_put(object, name, &object->name) == ERROR) {
     return ERROR;
   }
 
@@ -79,7 +130,7 @@ STATUS object_set_description(Object* object, char* description) {
     return ERROR;
   }
 
-  if (!strcpy(object->description, description)) {
+  if (object_utils_put(object, description, &object->description) == ERROR) {
     return ERROR;
   }
 
@@ -91,7 +142,7 @@ STATUS object_set_full_description(Object* object, char* full_description) {
     return ERROR;
   }
 
-  if (!strcpy(object->full_description, full_description)) {
+  if (object_utils_put(object, full_description, &object->full_description) == ERROR) {
     return ERROR;
   }
 
@@ -102,57 +153,114 @@ STATUS object_set_movable(Object* object, BOOL movable) {
   if (!object || !movable) {
     return ERROR;
   }
-  object->movable=movable;
-  return OK;
+  return object_utils_set_flag(object, OBJECT_MOVABLE, movable);
 }
 
 STATUS object_set_moved(Object* object, BOOL moved) {
   if (!object || !moved) {
     return ERROR;
   }
-  object->moved=moved;
-  return OK;
+  return object_utils_set_flag(object, OBJECT_MOVED, moved);
 }
 
 STATUS object_set_hidden(Object* object, BOOL hidden) {
   if (!object || !hidden) {
     return ERROR;
   }
-  object->hidden=hidden;
-  return OK;
+  return object_utils_set_flag(object, OBJECT_HIDDEN, hidden);
 }
 
 STATUS object_set_open(Object* object, Id id_link) {
   if (!object) {
     return ERROR;
   }
-  object->open=id_link;
-  return OK;
+  return object_table_set_open(object->table, object_utils_row(object), id_link);
 }
 
 STATUS object_set_illuminate(Object* object, BOOL illuminate) {
   if (!object) {
     return ERROR;
   }
-  object->illuminate=illuminate;
-  return OK;
+  return object_utils_set_flag(object, OBJECT_ILLUMINATE, illuminate);
 }
 
 STATUS object_set_turnedon(Object* object, BOOL turnedon) {
   if (!object) {
     return ERROR;
   }
-  object->turnedon=turnedon;
-  return OK;
+  return object_utils_set_flag(object, OBJECT_TURNEDON, turnedon);
 }
 
 const char* object_get_name(Object* object) {
   if (!object) {
     return NULL;
   }
+  return object_utils_get(object, object->name);
+}
+
+int object_get_name_handle(Object* object) {
+  if (!object) {
+    return NO_STRING;
+  }
   return object->name;
 }
 
+STATUS object_set_intern(Object* object, Intern* strings) {
+  if (!object || !strings) {
+    return ERROR;
+  }
+  if (object->strings == strings) {
+    return OK;
+  }
+
+  if (object->strings) {
+    object->name = intern_put(strings, intern_get(object->strings, object->name));
+    object->description = intern_put(strings, intern_get(object->strings, object->description));
+    object->full_description = intern_put(strings, intern_get(object->strings, object->full_description));
+    if (object->own_strings == TRUE)
+      intern_destroy(object->strings);
+  }
+  object->strings = strings;
+  object->own_strings = FALSE;
+
+  return OK;
+}
+
+STATUS object_set_table(Object* object, Object_table* table) {
+  int row, c;
+
+  if (!object || !table) {
+    return ERROR;
+  }
+  if (object->table == table) {
+    return OK;
+  }
+
+  row = object_table_add(table, object->id);
+  if (row == NO_ROW) {
+    return ERROR;
+  }
+  if (object->table) {
+    for (c=OBJECT_MOVABLE; c<=OBJECT_TURNEDON; c*=2)
+      object_table_set_flag(table, row, c, object_table_get_flag(object->table, object->row, c));
+    object_table_set_open(table, row, object_table_get_open(object->table, object->row));
+    if (object->own_table == TRUE)
+      object_table_destroy(object->table);
+  }
+  object->table = table;
+  object->row = row;
+  object->own_table = FALSE;
+
+  return OK;
+}
+
+Object_table* object_get_table(Object* object) {
+  if (!object) {
+    return NULL;
+  }
+  return object->table;
+}
+
 Id object_get_id(Object* object) {
   if (!object) {
     return NO_ID;
@@ -164,56 +272,56 @@ const char* object_get_description(Object *object){
   if (!object) {
     return NULL;
   }
-  return object->description;
+  return object_utils_get(object, object->description);
 }
 
 const char* object_get_full_description(Object *object) {
   if (!object) {
     return NULL;
   }
-  return object->full_description;
+  return object_utils_get(object, object->full_description);
 }
 
 BOOL object_get_movable(Object *object){
   if (!object){
     return FALSE;
   }
-  return object->movable;
+  return object_table_get_flag(object->table, object->row, OBJECT_MOVABLE);
 }
 
 BOOL object_get_moved(Object *object){
   if (!object){
     return FALSE;
   }
-  return object->moved;
+  return object_table_get_flag(object->table, object->row, OBJECT_MOVED);
 }
 
 BOOL object_get_hidden(Object *object){
   if (!object){
     return FALSE;
   }
-  return object->hidden;
+  return object_table_get_flag(object->table, object->row, OBJECT_HIDDEN);
 }
 
 Id object_get_open(Object *object){
   if (!object){
     return NO_ID;
   }
-  return object->open;
+  return object_table_get_open(object->table, object->row);
 }
 
 BOOL object_get_illuminate(Object *object){
   if (!object){
     return FALSE;
   }
-  return object->illuminate;
+  return object_table_get_flag(object->table, object->row, OBJECT_ILLUMINATE);
 }
 
 BOOL object_get_turnedon(Object *object){
   if (!object){
     return FALSE;
   }
-  return object->turnedon;
+  return object_table_get_flag(object->table, object->row, OBJECT_TURNEDON);
 }
 
 STATUS object_print(Object* object) {
@@ -222,33 +330,69 @@ STATUS object_print(Object* object) {
     return ERROR;
   }
 
-  fprintf(stdout, "--> Object (Id: %ld; Name: %s); Description: %s;\n-->Full description: %s", object->id, object->name, object->description, object->full_description);
-  if (object->movable==TRUE)
+  fprintf(stdout, "--> Object (Id: %ld; Name: %s); Description: %s;\n-->Full description: %s", object->id, object_get_name(object), object_get_description(object), object_get_full_description(object));
+  if (object_get_movable(object)==TRUE)
     fprintf(stdout, " Movable: TRUE)");
   else
     fprintf(stdout, " Movable: FALSE)");
 
-  if (object->moved==TRUE)
+  if (object_get_moved(object)==TRUE)
     fprintf(stdout, " Moved: TRUE)");
   else
     fprintf(stdout, " Moved: FALSE)");
 
-  if (object->moved==TRUE)
+  if (object_get_hidden(object)==TRUE)
     fprintf(stdout, " Hidden: TRUE)");
   else
     fprintf(stdout, " Hidden: FALSE)");
 
-  fprintf(stdout, " Open: %ld;)", object->open );
+  fprintf(stdout, " Open: %ld;)", object_get_open(object));
 
-  if (object->moved==TRUE)
+  if (object_get_illuminate(object)==TRUE)
     fprintf(stdout, " Illuminate: TRUE)");
   else
     fprintf(stdout, " Illuminate: FALSE)");
 
-  if (object->moved==TRUE)
+  if (object_get_turnedon(object)==TRUE)
     fprintf(stdout, " Turned On: TRUE)");
   else
     fprintf(stdout, " Turned On: FALSE)");
 
   return OK;
 }
+
+STATUS object_utils_put(Object* object, const char* str, int* handle) {
+  if (!object->strings) {
+    /* Until the object is added to a game it keeps its strings in a table of its own */
+    if ((object->strings = intern_create(NULL)) == NULL)
+      return ERROR;
+    object->own_strings = TRUE;
+  }
+  *handle = intern_put(object->strings, str);
+  if (*handle == NO_STRING && str[0] != '\0')
+    return ERROR;
+
+  return OK;
+}
+
+const char* object_utils_get(Object* object, int handle) {
+  if (!object->strings)
+    return "";
+  return intern_get(object->strings, handle);
+}
+
+int object_utils_row(Object* object) {
+  if (!object->table) {
+    /* Like its strings, until the object is added to a game it keeps its state in a table of its own */
+    if ((object->table = object_table_create()) == NULL)
+      return NO_ROW;
+    object->own_table = TRUE;
+    object->row = object_table_add(object->table, object->id);
+  }
+
+  return object->row;
+}
+
+STATUS object_utils_set_flag(Object* object, OBJECT_FLAG flag, BOOL value) {
+  return object_table_set_flag(object->table, object_utils_row(object), flag, value);
+}
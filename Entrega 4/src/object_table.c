@@ -0,0 +1,291 @@
+/**
+ * @brief Defines a table with the state of the objects (object_table)
+ *
+ * @file object_table.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "object_table.h"
+#include "id_table.h"
+
+#define OBJECT_N_FLAGS 5                                   /*!< Number of flags of an object */
+#define OBJECT_TABLE_BITS (CHAR_BIT*sizeof(unsigned long)) /*!< Rows in each word of a column */
+#define OBJECT_TABLE_INIT_ROWS 4                           /*!< Rows room is made for at first */
+
+/**
+ * @brief Table of objects
+ *
+ * This structure defines the state of the objects of a game, a column for each
+ * field, so the same field of every object is contiguous in memory.
+ */
+struct _Object_table {
+  Id *id;                                 /*!< Object of every row */
+  Id *open;                               /*!< Link every row can open */
+  Id *location;                           /*!< Where every row is, NO_ID if nowhere */
+  unsigned long *flags[OBJECT_N_FLAGS];   /*!< A column of bits for each flag */
+  int n_rows;                             /*!< Number of rows */
+  int max_rows;                           /*!< Room for rows before growing */
+  int n_words;                            /*!< Words of each column of bits */
+  Id_table *rows;                         /*!< Row of every object by its id */
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Gets the column of a flag.
+ * @param flag flag of an object.
+ * @return column of the flag, -1 if it is not a single flag.
+ */
+int object_table_utils_column(OBJECT_FLAG flag);
+
+/**
+ * @brief Makes room for one more row.
+ * @param table pointer to the table.
+ * @return OK if there is room for one more row, ERROR otherwise.
+ */
+STATUS object_table_utils_grow(Object_table* table);
+
+/**
+ * @brief Gets the lowest bit set in a word.
+ * @param word word with some bit set.
+ * @return position of the bit.
+ */
+int object_table_utils_lowest(unsigned long word);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
+Object_table* object_table_create() {
+  Object_table *table = NULL;
+  int c;
+
+  table = (Object_table *) malloc(sizeof(Object_table));
+  if (!table)
+    return NULL;
+
+  table->id = NULL;
+  table->open = NULL;
+  table->location = NULL;
+  for (c=0; c<OBJECT_N_FLAGS; c++)
+    table->flags[c] = NULL;
+  table->n_rows = 0;
+  table->max_rows = 0;
+  table->n_words = 0;
+  table->rows = id_table_create();
+  if (!table->rows) {
+    free(table);
+    return NULL;
+  }
+
+  return table;
+}
+
+void object_table_destroy(Object_table* table) {
+  int c;
+
+  if (!table)
+    return;
+
+  free(table->id);
+  free(table->open);
+  free(table->location);
+  id_table_destroy(table->rows);
+  for (c=0; c<OBJECT_N_FLAGS; c++)
+    free(table->flags[c]);
+  free(table);
+}
+
+int object_table_add(Object_table* table, Id id) {
+  if (!table || id == NO_ID || object_table_utils_grow(table) == ERROR)
+    return NO_ROW;
+  if (id_table_add(table->rows, id, table->n_rows) == ERROR)
+    return NO_ROW;
+
+  /* The bits of the new row were cleared when its word was made */
+  table->id[table->n_rows] = id;
+  table->open[table->n_rows] = NO_ID;
+  table->location[table->n_rows] = NO_ID;
+
+  return table->n_rows++;
+}
+
+Id object_table_get_id(Object_table* table, int row) {
+  if (!table || row < 0 || row >= table->n_rows)
+    return NO_ID;
+  return table->id[row];
+}
+
+int object_table_get_row(Object_table* table, Id id) {
+  int row;
+
+  if (!table)
+    return NO_ROW;
+  row = id_table_find(table->rows, id);
+  if (row == NO_ENTRY)
+    return NO_ROW;
+  return row;
+}
+
+STATUS object_table_set_flag(Object_table* table, int row, OBJECT_FLAG flag, BOOL value) {
+  int c = object_table_utils_column(flag);
+  unsigned long bit;
+
+  if (!table || row < 0 || row >= table->n_rows || c < 0)
+    return ERROR;
+
+  bit = 1UL << (row % OBJECT_TABLE_BITS);
+  if (value == TRUE)
+    table->flags[c][row / OBJECT_TABLE_BITS] |= bit;
+  else
+    table->flags[c][row / OBJECT_TABLE_BITS] &= ~bit;
+
+  return OK;
+}
+
+BOOL object_table_get_flag(Object_table* table, int row, OBJECT_FLAG flag) {
+  int c = object_table_utils_column(flag);
+
+  if (!table || row < 0 || row >= table->n_rows || c < 0)
+    return FALSE;
+
+  if (table->flags[c][row / OBJECT_TABLE_BITS] & (1UL << (row % OBJECT_TABLE_BITS)))
+    return TRUE;
+  return FALSE;
+}
+
+STATUS object_table_set_open(Object_table* table, int row, Id id_link) {
+  if (!table || row < 0 || row >= table->n_rows)
+    return ERROR;
+  table->open[row] = id_link;
+  return OK;
+}
+
+Id object_table_get_open(Object_table* table, int row) {
+  if (!table || row < 0 || row >= table->n_rows)
+    return NO_ID;
+  return table->open[row];
+}
+
+STATUS object_table_set_location(Object_table* table, int row, Id location) {
+  if (!table || row < 0 || row >= table->n_rows)
+    return ERROR;
+  table->location[row] = location;
+  return OK;
+}
+
+Id object_table_get_location(Object_table* table, int row) {
+  if (!table || row < 0 || row >= table->n_rows)
+    return NO_ID;
+  return table->location[row];
+}
+
+int object_table_find(Object_table* table, int with, int without, Set* within, Set* found) {
+  unsigned long word;
+  int w, c, row, n = 0, n_words;
+
+  if (!table)
+    return -1;
+
+  /* Only the words holding rows are looked at, the rest are room to grow */
+  n_words = (table->n_rows + OBJECT_TABLE_BITS - 1) / OBJECT_TABLE_BITS;
+  for (w=0; w<n_words; w++) {
+    /* The columns asked for are joined a whole word of rows at a time */
+    word = ~0UL;
+    for (c=0; c<OBJECT_N_FLAGS; c++) {
+      if (with & (1 << c))
+        word &= table->flags[c][w];
+      else if (without & (1 << c))
+        word &= ~table->flags[c][w];
+    }
+    if (w == n_words-1 && table->n_rows % OBJECT_TABLE_BITS)
+      word &= (1UL << (table->n_rows % OBJECT_TABLE_BITS)) - 1;
+
+    for (; word; word &= word-1) {
+      row = w*OBJECT_TABLE_BITS + object_table_utils_lowest(word);
+      if (within && set_has_id(within, table->id[row]) == FALSE)
+        continue;
+      if (found && set_add(found, table->id[row]) == ERROR)
+        return -1;
+      n++;
+    }
+  }
+
+  return n;
+}
+
+int object_table_get_number_of_rows(Object_table* table) {
+  if (!table)
+    return -1;
+  return table->n_rows;
+}
+
+int object_table_utils_column(OBJECT_FLAG flag) {
+  int c;
+
+  for (c=0; c<OBJECT_N_FLAGS; c++) {
+    if (flag == (1 << c))
+      return c;
+  }
+
+  return -1;
+}
+
+STATUS object_table_utils_grow(Object_table* table) {
+  unsigned long *bits = NULL;
+  Id *ids = NULL;
+  int c, max_rows, n_words;
+
+  if (table->n_rows < table->max_rows)
+    return OK;
+
+  /* A table of a single object takes a few rows, the columns of bits grow a word at a time */
+  max_rows = table->max_rows ? 2*table->max_rows : OBJECT_TABLE_INIT_ROWS;
+  ids = (Id *) realloc(table->id, max_rows*sizeof(Id));
+  if (!ids)
+    return ERROR;
+  table->id = ids;
+  ids = (Id *) realloc(table->open, max_rows*sizeof(Id));
+  if (!ids)
+    return ERROR;
+  table->open = ids;
+  ids = (Id *) realloc(table->location, max_rows*sizeof(Id));
+  if (!ids)
+    return ERROR;
+  table->location = ids;
+
+  /* The rows only count once every column has room for them */
+  n_words = (max_rows + OBJECT_TABLE_BITS - 1) / OBJECT_TABLE_BITS;
+  for (c=0; c<OBJECT_N_FLAGS; c++) {
+    bits = (unsigned long *) realloc(table->flags[c], n_words*sizeof(unsigned long));
+    if (!bits)
+      return ERROR;
+    memset(bits + table->n_words, 0, (n_words - table->n_words)*sizeof(unsigned long));
+    table->flags[c] = bits;
+  }
+  table->n_words = n_words;
+  table->max_rows = max_rows;
+
+  return OK;
+}
+
+int object_table_utils_lowest(unsigned long word) {
+#ifdef __GNUC__
+  return __builtin_ctzl(word);
+#else
+  int n = 0;
+
+  for (; !(word & 1UL); word >>= 1)
+    n++;
+
+  return n;
+#endif
+}
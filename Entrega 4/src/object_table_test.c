@@ -0,0 +1,164 @@
+/**
+ * @brief It tests object_table module
+ *
+ * @file object_table_test.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "object_table_test.h"
+#define MAX_TESTS 11
+
+/**
+ * @brief Main function to test object_table module.
+ *
+ * Two execution options:
+ *   1.-If no parameters, all test will run
+ *   2.-If you run with a number between 1 and the number of tests just run
+ *      the indicated test
+ *
+ */
+int main(int argc, char** argv) {
+
+    int test = 0;
+    int all = 1;
+
+    if (argc < 2) {
+        printf("Running all test for module object_table:\n");
+    } else {
+        test = atoi(argv[1]);
+        all = 0;
+        printf("Running test %d:\t", test);
+	if (test < 1 || test > MAX_TESTS) {
+	  printf("Error: unknown test %d\t", test);
+	  exit(EXIT_SUCCESS);
+        }
+    }
+
+
+    if (all || test == 1) test1_object_table_create();
+    if (all || test == 2) test1_object_table_add();
+    if (all || test == 3) test2_object_table_add();
+    if (all || test == 4) test1_object_table_set_flag();
+    if (all || test == 5) test2_object_table_set_flag();
+    if (all || test == 6) test1_object_table_set_open();
+    if (all || test == 7) test1_object_table_find();
+    if (all || test == 8) test2_object_table_find();
+    if (all || test == 9) test3_object_table_find();
+    if (all || test == 10) test4_object_table_find();
+    if (all || test == 11) test5_object_table_find();
+
+
+    PRINT_PASSED_PERCENTAGE;
+
+    return EXIT_SUCCESS;
+}
+
+void test1_object_table_create() {
+    Object_table *table = object_table_create();
+    PRINT_TEST_RESULT(table != NULL && object_table_get_number_of_rows(table) == 0);
+    object_table_destroy(table);
+}
+
+void test1_object_table_add() {
+    Object_table *table = object_table_create();
+    int row = object_table_add(table, 7);
+    PRINT_TEST_RESULT(row == 0 && object_table_get_id(table, row) == 7 && object_table_get_open(table, row) == NO_ID && object_table_get_flag(table, row, OBJECT_HIDDEN) == FALSE);
+    object_table_destroy(table);
+}
+
+void test2_object_table_add() {
+    Object_table *table = object_table_create();
+    PRINT_TEST_RESULT(object_table_add(table, NO_ID) == NO_ROW && object_table_add(NULL, 1) == NO_ROW);
+    object_table_destroy(table);
+}
+
+void test1_object_table_set_flag() {
+    Object_table *table = object_table_create();
+    int row;
+    object_table_add(table, 1);
+    row = object_table_add(table, 2);
+    object_table_set_flag(table, row, OBJECT_TURNEDON, TRUE);
+    object_table_set_flag(table, row, OBJECT_MOVED, TRUE);
+    object_table_set_flag(table, row, OBJECT_MOVED, FALSE);
+    PRINT_TEST_RESULT(object_table_get_flag(table, row, OBJECT_TURNEDON) == TRUE && object_table_get_flag(table, row, OBJECT_MOVED) == FALSE && object_table_get_flag(table, 0, OBJECT_TURNEDON) == FALSE);
+    object_table_destroy(table);
+}
+
+void test2_object_table_set_flag() {
+    Object_table *table = object_table_create();
+    int row = object_table_add(table, 1);
+    PRINT_TEST_RESULT(object_table_set_flag(table, row, OBJECT_MOVED | OBJECT_HIDDEN, TRUE) == ERROR && object_table_set_flag(table, row+1, OBJECT_MOVED, TRUE) == ERROR);
+    object_table_destroy(table);
+}
+
+void test1_object_table_set_open() {
+    Object_table *table = object_table_create();
+    int row = object_table_add(table, 1);
+    PRINT_TEST_RESULT(object_table_set_open(table, row, 42) == OK && object_table_get_open(table, row) == 42);
+    object_table_destroy(table);
+}
+
+void test1_object_table_find() {
+    Object_table *table = object_table_create();
+    Set *found = set_create();
+    int i, n;
+    /* Rows across several words, every third one gives light and every fifth one is turned off */
+    for (i=0; i<1000; i++) {
+        object_table_add(table, i+1);
+        if (i % 3 == 0) object_table_set_flag(table, i, OBJECT_ILLUMINATE, TRUE);
+        if (i % 5 != 0) object_table_set_flag(table, i, OBJECT_TURNEDON, TRUE);
+    }
+    n = object_table_find(table, OBJECT_ILLUMINATE | OBJECT_TURNEDON, 0, NULL, found);
+    PRINT_TEST_RESULT(n == 267 && set_get_num(found) == 267 && set_has_id(found, 4) == TRUE && set_has_id(found, 1) == FALSE);
+    set_destroy(found);
+    object_table_destroy(table);
+}
+
+void test2_object_table_find() {
+    Object_table *table = object_table_create();
+    int i;
+    for (i=0; i<70; i++) {
+        object_table_add(table, i+1);
+        if (i % 2) object_table_set_flag(table, i, OBJECT_HIDDEN, TRUE);
+    }
+    PRINT_TEST_RESULT(object_table_find(table, 0, OBJECT_HIDDEN, NULL, NULL) == 35 && object_table_find(table, 0, 0, NULL, NULL) == 70);
+    object_table_destroy(table);
+}
+
+void test3_object_table_find() {
+    Object_table *table = object_table_create();
+    Set *within = set_create();
+    int i;
+    for (i=0; i<10; i++) {
+        object_table_add(table, i+1);
+        object_table_set_flag(table, i, OBJECT_HIDDEN, TRUE);
+    }
+    set_add(within, 3);
+    set_add(within, 8);
+    set_add(within, 50);
+    PRINT_TEST_RESULT(object_table_find(table, OBJECT_HIDDEN, 0, within, NULL) == 2);
+    set_destroy(within);
+    object_table_destroy(table);
+}
+
+void test4_object_table_find() {
+    PRINT_TEST_RESULT(object_table_find(NULL, OBJECT_HIDDEN, 0, NULL, NULL) == -1);
+}
+
+void test5_object_table_find() {
+    Object_table *table = object_table_create();
+    int i;
+    /* More rows than a whole number of words, so the columns have words with no rows */
+    for (i=0; i<129; i++) {
+        object_table_add(table, i+1);
+        object_table_set_flag(table, i, OBJECT_HIDDEN, TRUE);
+    }
+    PRINT_TEST_RESULT(object_table_find(table, 0, OBJECT_HIDDEN, NULL, NULL) == 0 && object_table_find(table, OBJECT_HIDDEN, 0, NULL, NULL) == 129);
+    object_table_destroy(table);
+}
@@ -5,7 +5,7 @@
 
 
 
-#define MAX_TESTS 14
+#define MAX_TESTS 17
 
 /**
  * @brief Main function to test object module.
@@ -55,6 +55,10 @@ int main(int argc, char** argv) {
     if (all || test == 13) test1_object_get_name();
     if (all || test == 14) test2_object_get_name();
 
+    if (all || test == 15) test1_object_get_name_handle();
+    if (all || test == 16) test1_object_set_intern();
+    if (all || test == 17) test2_object_set_intern();
+
 
     PRINT_PASSED_PERCENTAGE;
 
@@ -145,3 +149,37 @@ void test2_object_get_name() {
     PRINT_TEST_RESULT(object_get_name(o) == NULL);
 
 }
+
+void test1_object_get_name_handle() {
+    Object *o1, *o2;
+    Intern *strings = intern_create(NULL);
+    o1 = object_create(1);
+    o2 = object_create(2);
+    object_set_intern(o1, strings);
+    object_set_intern(o2, strings);
+    object_set_name(o1, "llave");
+    object_set_name(o2, "llave");
+    PRINT_TEST_RESULT(object_get_name_handle(o1) == object_get_name_handle(o2) && object_get_name_handle(o1) != NO_STRING);
+    object_destroy(o1);
+    object_destroy(o2);
+    intern_destroy(strings);
+}
+
+void test1_object_set_intern() {
+    Object *o;
+    Intern *strings = intern_create(NULL);
+    o = object_create(1);
+    object_set_name(o, "llave");
+    object_set_description(o, "Abre la puerta");
+    PRINT_TEST_RESULT(object_set_intern(o, strings) == OK && strcmp(object_get_name(o), "llave") == 0 &&
+                      strcmp(object_get_description(o), "Abre la puerta") == 0 && intern_find(strings, "llave") == object_get_name_handle(o));
+    object_destroy(o);
+    intern_destroy(strings);
+}
+
+void test2_object_set_intern() {
+    Object *o;
+    o = object_create(1);
+    PRINT_TEST_RESULT(object_set_intern(o, NULL) == ERROR);
+    object_destroy(o);
+}
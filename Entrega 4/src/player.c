@@ -19,25 +19,35 @@
  */
 struct _Player {
   Id Id;                      /*!< Player identifier */
-  char name[WORD_SIZE + 1];   /*!< Player name */
+  int name;                   /*!< Handle of the player name */
   Id location;                /*!< Player location identifier */
   Inventory* object;          /*!< Inventory of objects carried by the player */
+  Intern* strings;            /*!< Table of the name */
+  BOOL own_strings;           /*!< TRUE if the table belongs to the player */
+  Arena* arena;               /*!< Arena of the player, NULL if it comes from malloc() */
 };
 
 Player* player_create(Id id, int maxobjects) {
+  return player_create_in(NULL, id, maxobjects);
+}
+
+Player* player_create_in(Arena* arena, Id id, int maxobjects) {
   Player *player=NULL;
 
   if(id == NO_ID) return NULL;
 
-  player=(Player*)malloc(sizeof(Player));
+  player=(Player*)arena_alloc(arena, sizeof(Player));
 
   if(player==NULL) return NULL;
 
   player->Id = id;
+  player->arena = arena;
 
-  player->name[0] = '\0';
+  player->name = NO_STRING;
+  player->strings = NULL;
+  player->own_strings = FALSE;
   player->location = NO_ID;
-  player->object=inventory_create(maxobjects);
+  player->object=inventory_create_in(arena, maxobjects);
   if (player->object==NULL) {
     player_destroy(player);
     return NULL;
@@ -51,7 +61,9 @@ STATUS player_destroy(Player* player) {
   if(player==NULL) return ERROR;
 
   inventory_destroy(player->object);
-  free(player);
+  if (player->own_strings == TRUE)
+    intern_destroy(player->strings);
+  arena_free(player->arena, player);
 
   player=NULL;
 
@@ -64,7 +76,15 @@ STATUS player_set_name(Player* player, char* name) {
     return ERROR;
   }
 
-  if (!strcpy(player->name, name)) {
+  if (!player->strings) {
+    /* Until the player is added to a game it keeps its name in a table of its own */
+    if ((player->strings = intern_create(NULL)) == NULL) {
+      return ERROR;
+    }
+    player->own_strings = TRUE;
+  }
+  player->name = intern_put(player->strings, name);
+  if (player->name == NO_STRING && name[0] != '\0') {
     return ERROR;
   }
 
@@ -90,7 +110,29 @@ const char * player_get_name(Player* player) {
   if (!player) {
     return NULL;
   }
-  return player->name;
+  if (!player->strings) {
+    return "";
+  }
+  return intern_get(player->strings, player->name);
+}
+
+STATUS player_set_intern(Player* player, Intern* strings) {
+  if (!player || !strings) {
+    return ERROR;
+  }
+  if (player->strings == strings) {
+    return OK;
+  }
+
+  if (player->strings) {
+    player->name = intern_put(strings, intern_get(player->strings, player->name));
+    if (player->own_strings == TRUE)
+      intern_destroy(player->strings);
+  }
+  player->strings = strings;
+  player->own_strings = FALSE;
+
+  return OK;
 }
 
 Id player_get_location(Player* player) {
@@ -105,6 +147,11 @@ Id player_get_object(Player*player, int index) {
   return inventory_get_object(player->object, index);
 }
 
+const Id* player_get_objects(Player* player, int* n) {
+  if(!player) return NULL;
+  return inventory_get_objects(player->object, n);
+}
+
 int player_get_maxobjects(Player* player) {
   if(!player) {
     return -1;
@@ -128,7 +175,7 @@ STATUS player_print(Player* player) {
     return ERROR;
   }
 
-  fprintf(stdout, "--> Player (Id: %ld; Name: %s; Id location: %ld; Objects:\n", player->Id, player->name, player->location);
+  fprintf(stdout, "--> Player (Id: %ld; Name: %s; Id location: %ld; Objects:\n", player->Id, player_get_name(player), player->location);
   inventory_print(player->object);
   fprintf(stdout, "\n\t)");
 
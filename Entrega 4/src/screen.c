@@ -17,9 +17,10 @@
 
 #define ROWS 69                                       /*!< Rows */
 #define COLUMNS 182                                    /*!< Columns */
-#define TOTAL_DATA (ROWS * COLUMNS * 4096) + 1               /*!< Total data */
+#define N_BORDERS 6                                   /*!< Borders painted around the five areas */
+#define MAX_ROWS 256                                  /*!< Max rows compared between frames */
 
-#define PROMPT " prompt:> "                           /*!< Character string ( prompt:> ) */
+#define PROMPT "prompt:> "                            /*!< Character string ( prompt:> ) */
 
 /**
  * @brief Área
@@ -28,9 +29,65 @@
  */
 struct _Area {
   char *string;              /*!< Cursor */
+  int len;                   /*!< Characters written, without the '\0' */
+  int size;                  /*!< Bytes allocated for string */
+  BOOL dirty;                /*!< Whether the contents have to be written again */
 };
 
-char *__data;
+/**
+ * @brief Row
+ *
+ * This structure defines a terminal row of a composed frame.
+ */
+typedef struct {
+  int start;                 /*!< Offset of the row in the frame */
+  int len;                   /*!< Bytes of the row */
+  int width;                 /*!< Visible characters of the row */
+  int sgr;                   /*!< Offset of the last SGR sequence before the row, -1 if none */
+  int sgr_len;               /*!< Length of that SGR sequence */
+} Row;
+
+char *__data = NULL;
+static char *__prev = NULL;   /*!< Frame painted on the terminal the last time */
+static int __data_size = 0;   /*!< Bytes allocated for each frame buffer */
+static int __areas_size = 0;  /*!< Sum of the sizes of every area created */
+static int __borders_len[N_BORDERS]; /*!< Length of every border */
+
+static Row __rows_buf[2][MAX_ROWS];          /*!< Rows of the current and the previous frame */
+static Row *__rows = __rows_buf[0];          /*!< Rows of the frame being painted */
+static Row *__prev_rows = __rows_buf[1];     /*!< Rows of the frame on the terminal */
+static int __n_prev_rows = -1;               /*!< Rows on the terminal, -1 to repaint them all */
+static BOOL __resized = FALSE;               /*!< Whether the terminal was already resized */
+
+static char *__out = NULL;    /*!< Bytes to send to the terminal for the current frame */
+static int __out_len = 0;     /*!< Bytes in __out */
+static int __out_size = 0;    /*!< Bytes allocated for __out */
+static FILE *__stats = NULL;  /*!< File the cost of every frame is reported on */
+static long __frames = 0;     /*!< Frames painted */
+static BOOL __utf8 = FALSE;   /*!< Whether the terminal shows UTF-8 text as it is */
+
+/**
+ * @brief ASCII fallback of every character from U+00A0 to U+00FF
+ */
+static const char __ascii[] =
+  " !cL?Y|S\"ca<--r-"
+  "o+23'uP.,1o>????"
+  "AAAAAAACEEEEIIII"
+  "DNOOOOOxOUUUUYPs"
+  "aaaaaaaceeeeiiii"
+  "dnooooo/ouuuuypy";
+
+/**
+ * @brief Borders painted before, between and after the areas
+ */
+static const char *__borders[N_BORDERS] = {
+  "\033[0;32;42m~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\033[0m",
+  "\033[0;32;42m~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\033[0m",
+  "\033[0;32;42m~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\033[0m",
+  "\033[0;32;42m~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\033[0m",
+  "\033[0;32;42m~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\033[0m",
+  "\033[0;32;42m~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\033[0m"
+};
 
 /****************************/
 /*     Private functions    */
@@ -39,58 +96,233 @@ char *__data;
 
 /**
  * @brief Replaces special characters.
- * @param str caracter a identificar si es especial.
- * @return entero a la posición ACCESS del cursor.
+ *
+ * Decodes str as UTF-8 in a single pass and in place. Every character is
+ * kept as it is if the terminal shows UTF-8, or replaced by its ASCII
+ * fallback otherwise; bytes that are not valid UTF-8 become '?'.
+ * @param str string to replace the characters of.
+ * @return length of str once replaced.
+ */
+int screen_utils_replaces_special_chars(char* str);
+
+/**
+ * @brief Appends bytes to the output of the frame.
+ * @param str bytes to append.
+ * @param len number of bytes.
+ * @return OK if they were appended, ERROR otherwise.
+ */
+STATUS screen_utils_out(const char *str, int len);
+
+/**
+ * @brief Sends the output of the frame to the terminal and empties it.
+ */
+void screen_utils_flush();
+
+/**
+ * @brief Composes a frame with the borders and the areas.
+ * @param areas the five areas, in the order they are painted.
+ * @return bytes of the frame, -1 if it could not be composed.
+ */
+int screen_utils_compose(Area **areas);
+
+/**
+ * @brief Splits a frame in terminal rows.
+ *
+ * A row ends at a '\n' or when COLUMNS characters have been written. SGR
+ * sequences take no room; the last one before each row is recorded so the
+ * row can be painted on its own.
+ * @param frame composed frame.
+ * @param len bytes of the frame.
+ * @param rows array where the rows are stored.
+ * @return number of rows, -1 if there are more than MAX_ROWS.
+ */
+int screen_utils_split_rows(const char *frame, int len, Row *rows);
+
+/**
+ * @brief Tells if a row differs from the one on the terminal.
+ * @param i index of the row.
+ * @return TRUE if the row has to be painted again, FALSE otherwise.
+ */
+BOOL screen_utils_row_changed(int i);
+
+/**
+ * @brief Paints a single row of the frame at its place on the terminal.
+ * @param i index of the row.
  */
-void screen_utils_replaces_special_chars(char* str);
+void screen_utils_paint_row(int i);
 
 /****************************/
 /* Functions implementation */
 /****************************/
 void screen_init() {
+  int i, frame_size;
+
   screen_destroy(); /* Dispose if previously initialized */
-  __data = (char *) malloc(sizeof(char) * TOTAL_DATA);
 
-  if (__data)
-    *(__data + TOTAL_DATA - 1) = '\0';         /*NULL-terminated string*/
-  fprintf(stdout, "\033[8;%d;%dt", ROWS+2, COLUMNS);
+  /* Worst case frame: every area full plus the borders */
+  frame_size = __areas_size + 1;
+  for (i=0; i<N_BORDERS; i++) {
+    __borders_len[i] = strlen(__borders[i]);
+    frame_size += __borders_len[i];
+  }
+
+  __data = (char *) malloc(sizeof(char) * frame_size);
+  __prev = (char *) malloc(sizeof(char) * frame_size);
+  /* A full repaint is the frame plus a few sequences for every row */
+  __out = (char *) malloc(sizeof(char) * (frame_size + MAX_ROWS*32));
+  if (!__data || !__prev || !__out) {
+    screen_destroy();
+    return;
+  }
+  __data_size = frame_size;
+  __data[0] = '\0';
+  __n_prev_rows = -1;
+  __out_size = frame_size + MAX_ROWS*32;
+  __out_len = 0;
 }
 
 void screen_destroy() {
   if (__data)
     free(__data);
+  if (__prev)
+    free(__prev);
+  if (__out)
+    free(__out);
+  __data = NULL;
+  __prev = NULL;
+  __out = NULL;
+  __data_size = 0;
+  __out_size = 0;
+  __out_len = 0;
+  __n_prev_rows = -1;
+}
+
+void screen_reset() {
+  if (__data)
+    __data[0] = '\0';
 }
 
 void screen_paint(Area* area1, Area* area2, Area* area3, Area* area4, Area* area5) {
+  Area *areas[N_BORDERS-1];
+  Row *rows = NULL;
+  char *aux = NULL;
+  char seq[SCREEN_MAX_STR];
+  int i, len, n_rows;
+
+  areas[0]=area1; areas[1]=area2; areas[2]=area3; areas[3]=area4; areas[4]=area5;
+
+  if ((len = screen_utils_compose(areas)) < 0)
+    return;
+
+  if (__resized == FALSE) {
+    /* One row more than before for the line the player types the command in */
+    sprintf(seq, "\033[8;%d;%dt", ROWS+3, COLUMNS);
+    screen_utils_out(seq, strlen(seq));
+    __resized = TRUE;
+  }
+
+  n_rows = screen_utils_split_rows(__data, len, __rows);
+  if (n_rows < 0) {
+    /* Too big to keep track of, dump it all as it is */
+    screen_utils_out("\033[2J\n", 5); /*Clear the terminal*/
+    screen_utils_out(__data, len); /*Dump data directly to the terminal*/
+    screen_utils_out("\n", 1);
+    __n_prev_rows = -1;
+  }
+  else {
+    /* Only the rows that changed since the last frame are sent */
+    if (__n_prev_rows < 0)
+      screen_utils_out("\033[2J", 4); /*Clear the terminal*/
+    for (i=0; i<n_rows; i++) {
+      if (screen_utils_row_changed(i) == TRUE)
+        screen_utils_paint_row(i);
+    }
+    /* Wipes what is left of the previous frame and the last command */
+    sprintf(seq, "\033[0m\033[%d;1H\033[J", n_rows+1);
+    screen_utils_out(seq, strlen(seq));
 
-  strcpy(__data, "\0");
-  if (__data) {
+    aux = __prev;
+    __prev = __data;
+    __data = aux;
+    rows = __prev_rows;
+    __prev_rows = __rows;
+    __rows = rows;
+    __n_prev_rows = n_rows;
+  }
+  screen_utils_out(PROMPT, strlen(PROMPT));
+  screen_utils_flush();
+
+  /*It works fine if the terminal window has the right size*/
+  screen_reset();
+}
+
+void screen_snapshot(FILE* file, Area* area1, Area* area2, Area* area3, Area* area4, Area* area5) {
+  Area *areas[N_BORDERS-1];
+  int i, j, k, len, n_rows, end;
 
-    puts("\033[2J"); /*Clear the terminal*/
-    strcpy(__data+strlen(__data), "\033[0;32;42m~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\033[0m");
-    memcpy(__data+strlen(__data), area1->string, strlen(area1->string));
-    strcpy(__data+strlen(__data), "\033[0;32;42m~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\033[0m");
-    memcpy(__data+strlen(__data), area2->string, strlen(area2->string));
-    strcpy(__data+strlen(__data), "\033[0;32;42m~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\033[0m");
-    memcpy(__data+strlen(__data), area3->string, strlen(area3->string));
-    strcpy(__data+strlen(__data), "\033[0;32;42m~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\033[0m");
-    memcpy(__data+strlen(__data), area4->string, strlen(area4->string));
-    strcpy(__data+strlen(__data), "\033[0;32;42m~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\033[0m");
-    memcpy(__data+strlen(__data), area5->string, strlen(area5->string));
-    strcpy(__data+strlen(__data), "\033[0;32;42m~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\033[0m");
+  areas[0]=area1; areas[1]=area2; areas[2]=area3; areas[3]=area4; areas[4]=area5;
 
-    puts(__data); /*Dump data directly to the terminal*/
-    /*It works fine if the terminal window has the right size*/
-    strcpy(__data, "\0");
+  if (!file || (len = screen_utils_compose(areas)) < 0)
+    return;
+
+  n_rows = screen_utils_split_rows(__data, len, __rows);
+  if (n_rows < 0) {
+    /* Too many rows, the frame goes as a single one */
+    n_rows = 1;
+    __rows[0].start = 0;
+    __rows[0].len = len;
+  }
+
+  for (i=0; i<n_rows; i++) {
+    end = __rows[i].start + __rows[i].len;
+    for (j=__rows[i].start; j<end; j=k) {
+      /* Writes the text up to the next control sequence and skips it */
+      for (k=j; k<end && __data[k] != '\033'; k++);
+      fwrite(__data+j, sizeof(char), k-j, file);
+      if (k < end && k+1 < end && __data[k+1] == '[') {
+        for (k+=2; k<end && (__data[k] < 0x40 || __data[k] > 0x7E); k++);
+        k++;
+      }
+      else if (k < end) {
+        k++;
+      }
+    }
+    fputc('\n', file);
   }
+  fputc('\n', file);
+
+  screen_reset();
+}
+
+void screen_set_stats(FILE* file) {
+  __stats = file;
+}
+
+void screen_set_utf8(BOOL utf8) {
+  __utf8 = utf8;
 }
 
 Area* screen_area_init(int size) {
   Area* area = NULL;
 
-  area=malloc(sizeof(area));
-  area->string=malloc(size*sizeof(char));
+  if (size < 1)
+    return NULL;
+
+  area=(Area *) malloc(sizeof(Area));
+  if (!area)
+    return NULL;
+  area->string=(char *) malloc(size*sizeof(char));
+  if (!area->string) {
+    free(area);
+    return NULL;
+  }
   area->string[0]='\0';
+  area->len=0;
+  area->size=size;
+  area->dirty=TRUE;
+
+  /* The frame buffer must be able to hold this area full */
+  __areas_size += size;
 
   return area;
 }
@@ -107,21 +339,263 @@ void screen_area_destroy(Area* area) {
 void  screen_area_clear(Area* area) {
   if(area) {
     if (area->string) {
-      strcpy(area->string, "\0");
+      area->string[0]='\0';
+      area->len=0;
+    }
+  }
+}
+
+STATUS screen_area_puts(Area* area, char *str) {
+  if (!area || !str)
+    return ERROR;
+
+  return screen_area_write(area, str, screen_utils_replaces_special_chars(str));
+}
+
+STATUS screen_area_write(Area* area, const char *str, int len) {
+  char *aux = NULL;
+  int size;
+
+  if (!area || !str || len < 0)
+    return ERROR;
+
+  if (area->len + len + 1 > area->size) {
+    /* Doubles the area so a run of appends stays linear */
+    size = area->size;
+    while (area->len + len + 1 > size)
+      size *= 2;
+    aux = (char *) realloc(area->string, size*sizeof(char));
+    if (!aux)
+      return ERROR;
+    area->string = aux;
+    area->size = size;
+  }
+
+  memcpy(area->string+area->len, str, len);
+  area->len += len;
+  area->string[area->len] = '\0';
+
+  return OK;
+}
+
+STATUS screen_area_set_dirty(Area* area, BOOL dirty) {
+  if (!area)
+    return ERROR;
+  area->dirty = dirty;
+  return OK;
+}
+
+BOOL screen_area_is_dirty(Area* area) {
+  if (!area)
+    return FALSE;
+  return area->dirty;
+}
+
+const char* screen_area_get_string(Area* area) {
+  if (!area)
+    return NULL;
+  return area->string;
+}
+
+int screen_area_get_length(Area* area) {
+  if (!area)
+    return -1;
+  return area->len;
+}
+
+int screen_utils_replaces_special_chars(char* str) {
+  unsigned char *in = (unsigned char *) str;
+  unsigned long cp;
+  int i = 0, j = 0, n, k;
+
+  while (in[i] != '\0') {
+    if (in[i] < 0x80) {
+      /* Plain ASCII is only moved once something before it got shorter */
+      if (j != i)
+        str[j] = str[i];
+      i++;
+      j++;
+      continue;
     }
+
+    /* Length of the sequence from its leading byte */
+    if (in[i] >= 0xC2 && in[i] <= 0xDF) {
+      n = 2;
+      cp = in[i] & 0x1F;
+    }
+    else if (in[i] >= 0xE0 && in[i] <= 0xEF) {
+      n = 3;
+      cp = in[i] & 0x0F;
+    }
+    else if (in[i] >= 0xF0 && in[i] <= 0xF4) {
+      n = 4;
+      cp = in[i] & 0x07;
+    }
+    else {
+      n = 1;
+      cp = 0;
+    }
+    for (k=1; k<n && (in[i+k] & 0xC0) == 0x80; k++)
+      cp = (cp << 6) | (in[i+k] & 0x3F);
+
+    if (n == 1 || k < n)
+      str[j++] = '?';
+    else if (__utf8 == TRUE) {
+      memmove(str+j, str+i, n);
+      j += n;
+    }
+    else
+      str[j++] = (cp >= 0xA0 && cp <= 0xFF) ? __ascii[cp-0xA0] : '?';
+    i += k;
   }
+  if (j != i)
+    str[j] = '\0';
+
+  return j;
 }
 
-void screen_area_puts(Area* area, char *str) {
-  screen_utils_replaces_special_chars(str);
+STATUS screen_utils_out(const char *str, int len) {
+  char *aux = NULL;
+  int size;
+
+  if (__out_len + len > __out_size) {
+    size = __out_size > 0 ? __out_size : 1;
+    while (__out_len + len > size)
+      size *= 2;
+    aux = (char *) realloc(__out, size*sizeof(char));
+    if (!aux)
+      return ERROR;
+    __out = aux;
+    __out_size = size;
+  }
+
+  memcpy(__out+__out_len, str, len);
+  __out_len += len;
+
+  return OK;
+}
+
+void screen_utils_flush() {
+  int sent = 0, n, writes = 0;
+
+  /* The terminal backend leaves stdout unbuffered, so fwrite is a single write unless the terminal takes less */
+  while (sent < __out_len) {
+    n = fwrite(__out+sent, sizeof(char), __out_len-sent, stdout);
+    writes++;
+    if (n <= 0)
+      break;
+    sent += n;
+  }
+
+  __frames++;
+  if (__stats)
+    fprintf(__stats, "frame %ld: %d bytes, %d writes\n", __frames, sent, writes);
+  __out_len = 0;
+}
+
+int screen_utils_compose(Area **areas) {
+  char *aux = NULL;
+  int i, len, pos;
+
+  if (!__data)
+    return -1;
+
+  len = 1;
+  for (i=0; i<N_BORDERS; i++) {
+    len += __borders_len[i];
+    if (i<N_BORDERS-1)
+      len += areas[i]->len;
+  }
+
+  /* Only reached if an area outgrew the size it was created with */
+  if (len > __data_size) {
+    aux = (char *) realloc(__data, sizeof(char) * len);
+    if (!aux)
+      return -1;
+    __data = aux;
+    aux = (char *) realloc(__prev, sizeof(char) * len);
+    if (!aux)
+      return -1;
+    __prev = aux;
+    __data_size = len;
+  }
+
+  for (i=0, pos=0; i<N_BORDERS; i++) {
+    memcpy(__data+pos, __borders[i], __borders_len[i]);
+    pos += __borders_len[i];
+    if (i<N_BORDERS-1) {
+      memcpy(__data+pos, areas[i]->string, areas[i]->len);
+      pos += areas[i]->len;
+    }
+  }
+  __data[pos] = '\0';
+
+  return pos;
+}
+
+int screen_utils_split_rows(const char *frame, int len, Row *rows) {
+  int i, j, n = 0, sgr = -1, sgr_len = 0;
+
+  rows[0].start = 0;
+  rows[0].width = 0;
+  rows[0].sgr = -1;
+  rows[0].sgr_len = 0;
+
+  for (i=0; i<len; i++) {
+    if (frame[i] == '\033' && i+1 < len && frame[i+1] == '[') {
+      /* Control sequence: parameters up to the final byte */
+      for (j=i+2; j<len && (frame[j] < 0x40 || frame[j] > 0x7E); j++);
+      if (j < len && frame[j] == 'm') {
+        sgr = i;
+        sgr_len = j-i+1;
+      }
+      i = j;
+      continue;
+    }
+    if (frame[i] == '\n' || (rows[n].width == COLUMNS && (frame[i] & 0xC0) != 0x80)) {
+      rows[n].len = i - rows[n].start;
+      if (++n == MAX_ROWS)
+        return -1;
+      rows[n].start = (frame[i] == '\n') ? i+1 : i;
+      rows[n].width = 0;
+      rows[n].sgr = sgr;
+      rows[n].sgr_len = sgr_len;
+      if (frame[i] == '\n')
+        continue;
+    }
+    /* UTF-8 continuation bytes take no room */
+    if ((frame[i] & 0xC0) != 0x80)
+      rows[n].width++;
+  }
+  rows[n].len = len - rows[n].start;
+
+  return n+1;
+}
+
+BOOL screen_utils_row_changed(int i) {
+  Row *row = &__rows[i], *prev = &__prev_rows[i];
+
+  if (i >= __n_prev_rows)
+    return TRUE;
+  if (row->len != prev->len || row->sgr_len != prev->sgr_len)
+    return TRUE;
+  if (memcmp(__data+row->start, __prev+prev->start, row->len) != 0)
+    return TRUE;
+  if (row->sgr >= 0 && memcmp(__data+row->sgr, __prev+prev->sgr, row->sgr_len) != 0)
+    return TRUE;
 
-  strcpy(area->string+strlen(area->string), str);
+  return FALSE;
 }
 
-void screen_utils_replaces_special_chars(char* str) {
-  char *pch = NULL;
+void screen_utils_paint_row(int i) {
+  Row *row = &__rows[i];
+  char seq[SCREEN_MAX_STR];
 
-  /* Replaces acutes and tilde with '??' */
-  while ((pch = strpbrk (str, "ÁÉÍÓÚÑáéíóúñ")))
-    memcpy(pch, "??", 2);
+  sprintf(seq, "\033[%d;1H\033[0m", i+1);
+  screen_utils_out(seq, strlen(seq));
+  if (row->sgr >= 0)
+    screen_utils_out(__data+row->sgr, row->sgr_len);
+  screen_utils_out(__data+row->start, row->len);
+  if (row->width < COLUMNS)
+    screen_utils_out("\033[0m\033[K", 7);
 }
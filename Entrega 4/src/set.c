@@ -12,30 +12,120 @@
 #include <string.h>
 #include "set.h"
 
+#define SET_INIT_SIZE 4     /*!< Identifiers room is made for at first */
+#define SET_EMPTY -1        /*!< Bucket never used */
+#define SET_DELETED -2      /*!< Bucket of an identifier deleted */
+#define SET_WORD_BITS (8*(int)sizeof(unsigned long))  /*!< Identifiers in every word of a bit set */
+
 /**
 * @brief  conjunto
 *
-*  This structure defines a set
+*  This structure defines a set. In a HASH_SET the identifiers are kept in the
+*  order they were added, and a hash table gives the position of each of them.
+*  In a BIT_SET identifier i is bit i of the words, so they are kept in order.
 */
 struct _Set {
-  Id id[MAX_ID];        /*!< Identifers */
+  SET_TYPE type;        /*!< Implementation of the set */
+  Id *id;               /*!< Identifers, NO_ID where one was deleted */
+  int used;             /*!< Positions of id used, deleted ones included */
   int num;              /*!< Number of identifiers */
+  int size;             /*!< Room in id */
+  int *bucket;          /*!< Hash table of positions in id, SET_EMPTY or SET_DELETED */
+  int n_buckets;        /*!< Buckets of the table, twice size */
+  int n_deleted;        /*!< Buckets marked SET_DELETED */
+  unsigned long *bits;  /*!< Words of a BIT_SET */
+  int n_words;          /*!< Number of words */
+  int cursor_word;      /*!< Word the last set_get() of a BIT_SET found its identifier in */
+  int cursor_index;     /*!< Index of the first identifier of cursor_word */
+  Arena* arena;         /*!< Arena of the set, NULL if it comes from malloc() */
 };
 
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Hash of an identifier.
+ * @param id identifier.
+ * @return hash of the identifier.
+ */
+unsigned long set_utils_hash(Id id);
+
+/**
+ * @brief Looks for the bucket of an identifier.
+ * @param set pointer to the set.
+ * @param id identifier.
+ * @return bucket holding the position of the identifier, -1 if it is not in the set.
+ */
+int set_utils_find(Set* set, Id id);
+
+/**
+ * @brief Moves the identifiers to the beginning of id, removing the holes left by
+ * deletions, and builds the hash table again with room for size identifiers.
+ * @param set pointer to the set.
+ * @param size new room of the set, not smaller than num.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS set_utils_rebuild(Set* set, int size);
+
+/**
+ * @brief Number of bits set in a word.
+ * @param word word.
+ * @return number of bits set.
+ */
+int set_utils_popcount(unsigned long word);
+
+/**
+ * @brief Adds an identifier to a BIT_SET, making room for it.
+ * @param set pointer to the set.
+ * @param id identifier, not negative.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS set_bits_add(Set* set, Id id);
+
+/**
+ * @brief Gets an identifier of a BIT_SET by index, in increasing order.
+ * @param set pointer to the set.
+ * @param index index, between 0 and num-1.
+ * @return the identifier.
+ */
+Id set_bits_get(Set* set, int index);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
 Set* set_create() {
-  int i;
+  return set_create_type(NULL, HASH_SET);
+}
+
+Set* set_create_in(Arena* arena) {
+  return set_create_type(arena, HASH_SET);
+}
+
+Set* set_create_type(Arena* arena, SET_TYPE type) {
   Set *set = NULL;
 
-  set = (Set*)malloc(sizeof(Set));
+  set = (Set*)arena_alloc(arena, sizeof(Set));
 
   if (set == NULL) {
     return NULL;
   }
 
-  for (i=0; i<MAX_ID; i++) {
-    set->id[i]=NO_ID;
-  }
+  /* Room is made with the first identifier, as most sets are empty */
+  set->type=type;
+  set->id=NULL;
+  set->used=0;
   set->num=0;
+  set->size=0;
+  set->bucket=NULL;
+  set->n_buckets=0;
+  set->n_deleted=0;
+  set->bits=NULL;
+  set->n_words=0;
+  set->cursor_word=0;
+  set->cursor_index=0;
+  set->arena=arena;
 
   return set;
 }
@@ -44,7 +134,10 @@ STATUS set_destroy(Set* set) {
   if (!set)
     return ERROR;
 
-  free(set);
+  arena_free(set->arena, set->id);
+  arena_free(set->arena, set->bucket);
+  arena_free(set->arena, set->bits);
+  arena_free(set->arena, set);
   set=NULL;
 
   return OK;
@@ -57,57 +150,83 @@ int set_get_num(Set *set) {
 }
 
 STATUS set_add(Set* set, Id id) {
+  unsigned long mask;
   int i;
+
   if (!set || id==NO_ID)
     return ERROR;
-  for (i=0; i<set->num; i++) {
-    if (set->id[i]==id)
-      return OK;
+  if (set->type==BIT_SET)
+    return set_bits_add(set, id);
+  if (set_utils_find(set, id) != -1)
+    return OK;
+
+  if (set->used==set->size) {
+    /* Holes are removed if that leaves room enough, otherwise the set doubles */
+    if (set_utils_rebuild(set, set->num < set->size/2 ? set->size : (set->size ? 2*set->size : SET_INIT_SIZE))==ERROR)
+      return ERROR;
   }
-  if (set->num==MAX_ID)
-    return ERROR;
-  set->id[set->num]=id;
-  (set->num)++;
+  else if (set->n_deleted > set->size/2) {
+    if (set_utils_rebuild(set, set->size)==ERROR)
+      return ERROR;
+  }
+
+  mask = set->n_buckets-1;
+  for (i = set_utils_hash(id) & mask; set->bucket[i] >= 0; i = (i+1) & mask);
+  if (set->bucket[i]==SET_DELETED)
+    set->n_deleted--;
+  set->bucket[i]=set->used;
+  set->id[set->used]=id;
+  set->used++;
+  set->num++;
+
   return OK;
 }
 
 STATUS set_del(Set* set, Id id) {
-  int i, j;
-  Id aux;
+  int i;
+
   if (!set || id==NO_ID || set->num==0)
     return ERROR;
-  for (i=0; i<set->num; i++) {
-    if (set->id[i]==id) {
-      set->id[i]=NO_ID;
-      j=i+1;
-      while(set->id[j]!=NO_ID || j<set->num) {
-        aux=set->id[j-1];
-        set->id[j-1]=set->id[j];
-        set->id[j]=aux;
-        j++;
-      }
-      (set->num)--;
-      return OK;
-    }
+  if (set->type==BIT_SET) {
+    if (set_has_id(set, id)==FALSE)
+      return ERROR;
+    set->bits[id/SET_WORD_BITS] &= ~(1UL << (id%SET_WORD_BITS));
+    set->num--;
+    set->cursor_word=set->cursor_index=0;
+    return OK;
   }
-  return ERROR;
+  if ((i = set_utils_find(set, id)) == -1)
+    return ERROR;
+
+  set->id[set->bucket[i]]=NO_ID;
+  set->bucket[i]=SET_DELETED;
+  set->n_deleted++;
+  set->num--;
+  while (set->used > 0 && set->id[set->used-1]==NO_ID)
+    set->used--;
+
+  return OK;
 }
 
 Id set_get(Set* set, int index) {
   if (!set || index<0 || index>set->num-1)
     return NO_ID;
+  if (set->type==BIT_SET)
+    return set_bits_get(set, index);
+  if (set->used != set->num && set_utils_rebuild(set, set->size)==ERROR)
+    return NO_ID;
   return set->id[index];
 }
 
 BOOL set_has_id(Set* set, Id id) {
-  int i;
   if (!set || set->num==0)
     return FALSE;
-  for (i=0; set->id[i]!=NO_ID && i<set->num; i++) {
-    if (id==set->id[i])
-      return TRUE;
+  if (set->type==BIT_SET) {
+    if (id<0 || id/SET_WORD_BITS>=set->n_words)
+      return FALSE;
+    return (set->bits[id/SET_WORD_BITS] >> (id%SET_WORD_BITS)) & 1UL ? TRUE : FALSE;
   }
-  return FALSE;
+  return set_utils_find(set, id) != -1 ? TRUE : FALSE;
 }
 
 STATUS set_print(Set* set) {
@@ -117,10 +236,152 @@ STATUS set_print(Set* set) {
   }
 
   fprintf(stdout, "--> Set (Id:\n");
-  for (i=0; i<set->num; i++) {
-    fprintf(stdout, "    %ld\n", set->id[i]);
+  for (i=0; set->type==BIT_SET && i<set->num; i++) {
+    fprintf(stdout, "    %ld\n", set_bits_get(set, i));
+  }
+  for (i=0; set->type==HASH_SET && i<set->used; i++) {
+    if (set->id[i]!=NO_ID)
+      fprintf(stdout, "    %ld\n", set->id[i]);
   }
   fprintf(stdout, "    Number: %d)\n", set->num);
 
   return OK;
 }
+
+unsigned long set_utils_hash(Id id) {
+  unsigned long hash = (unsigned long) id;
+
+  hash ^= hash >> 16;
+  hash *= 0x45d9f3bUL;
+  hash ^= hash >> 16;
+
+  return hash;
+}
+
+int set_utils_find(Set* set, Id id) {
+  unsigned long mask;
+  int i;
+
+  if (set->n_buckets==0 || id==NO_ID)
+    return -1;
+
+  mask = set->n_buckets-1;
+  for (i = set_utils_hash(id) & mask; set->bucket[i]!=SET_EMPTY; i = (i+1) & mask) {
+    if (set->bucket[i] >= 0 && set->id[set->bucket[i]]==id)
+      return i;
+  }
+
+  return -1;
+}
+
+STATUS set_utils_rebuild(Set* set, int size) {
+  Id *id = set->id;
+  int *bucket = set->bucket;
+  unsigned long mask;
+  int i, j, n = 0;
+
+  /* Memory is only taken to grow: the memory of an arena is not given back, so
+     removing the holes reuses the arrays, moving the identifiers down in place */
+  if (size != set->size) {
+    id = (Id*)arena_alloc(set->arena, size*sizeof(Id));
+    bucket = (int*)arena_alloc(set->arena, 2*size*sizeof(int));
+    if (!id || !bucket) {
+      arena_free(set->arena, id);
+      arena_free(set->arena, bucket);
+      return ERROR;
+    }
+  }
+
+  for (i=0; i<2*size; i++)
+    bucket[i]=SET_EMPTY;
+  mask = 2*size-1;
+  for (i=0; i<set->used; i++) {
+    if (set->id[i]==NO_ID)
+      continue;
+    id[n]=set->id[i];
+    for (j = set_utils_hash(id[n]) & mask; bucket[j]!=SET_EMPTY; j = (j+1) & mask);
+    bucket[j]=n;
+    n++;
+  }
+
+  if (id != set->id) {
+    arena_free(set->arena, set->id);
+    arena_free(set->arena, set->bucket);
+  }
+  set->id=id;
+  set->bucket=bucket;
+  set->size=size;
+  set->n_buckets=2*size;
+  set->used=n;
+  set->n_deleted=0;
+
+  return OK;
+}
+
+int set_utils_popcount(unsigned long word) {
+#ifdef __GNUC__
+  return __builtin_popcountl(word);
+#else
+  int n = 0;
+
+  for (; word; n++)
+    word &= word-1;
+
+  return n;
+#endif
+}
+
+STATUS set_bits_add(Set* set, Id id) {
+  unsigned long *bits = NULL;
+  int i, n_words;
+
+  if (id<0)
+    return ERROR;
+
+  if (id/SET_WORD_BITS >= set->n_words) {
+    n_words = set->n_words ? set->n_words : 1;
+    while (id/SET_WORD_BITS >= n_words)
+      n_words *= 2;
+    bits = (unsigned long*)arena_alloc(set->arena, n_words*sizeof(unsigned long));
+    if (!bits)
+      return ERROR;
+    for (i=0; i<n_words; i++)
+      bits[i] = i<set->n_words ? set->bits[i] : 0UL;
+    arena_free(set->arena, set->bits);
+    set->bits=bits;
+    set->n_words=n_words;
+  }
+
+  if (!((set->bits[id/SET_WORD_BITS] >> (id%SET_WORD_BITS)) & 1UL)) {
+    set->bits[id/SET_WORD_BITS] |= 1UL << (id%SET_WORD_BITS);
+    set->num++;
+    set->cursor_word=set->cursor_index=0;
+  }
+
+  return OK;
+}
+
+Id set_bits_get(Set* set, int index) {
+  unsigned long word;
+  int w = 0, first = 0, n;
+
+  /* Going through the identifiers in order starts where the last one was found */
+  if (index >= set->cursor_index) {
+    w = set->cursor_word;
+    first = set->cursor_index;
+  }
+  while ((n = set_utils_popcount(set->bits[w])) <= index-first) {
+    first += n;
+    w++;
+  }
+  set->cursor_word=w;
+  set->cursor_index=first;
+
+  for (word = set->bits[w]; ; word &= word-1) {
+    if (first++ == index)
+      break;
+  }
+  for (n=0; !((word >> n) & 1UL); n++);
+
+  return (Id)w*SET_WORD_BITS + n;
+}
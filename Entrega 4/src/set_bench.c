@@ -0,0 +1,134 @@
+/**
+ * @brief Compares the set with the fixed array it replaced
+ *
+ * @file set_bench.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "set.h"
+
+#define N_SIZES 3
+#define MIN_OPS 2000000L   /*!< Operations timed at least, so small sizes are measurable */
+
+/**
+ * @brief Array set as it was before, without its old limit of ids
+ */
+typedef struct {
+  Id *id;
+  int num;
+} Array_set;
+
+/**
+ * @brief Adds an identifier to an array set, looking for it first
+ */
+void array_add(Array_set* set, Id id) {
+  int i;
+  for (i=0; i<set->num; i++) {
+    if (set->id[i]==id)
+      return;
+  }
+  set->id[set->num++]=id;
+}
+
+/**
+ * @brief Looks for an identifier in an array set
+ */
+BOOL array_has_id(Array_set* set, Id id) {
+  int i;
+  for (i=0; i<set->num; i++) {
+    if (set->id[i]==id)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/**
+ * @brief Removes an identifier from an array set, shifting the rest
+ */
+void array_del(Array_set* set, Id id) {
+  int i;
+  for (i=0; i<set->num; i++) {
+    if (set->id[i]==id) {
+      for (; i<set->num-1; i++)
+        set->id[i]=set->id[i+1];
+      set->num--;
+      return;
+    }
+  }
+}
+
+/**
+ * @brief Seconds since start
+ */
+double elapsed(clock_t start) {
+  return (double)(clock()-start)/CLOCKS_PER_SEC;
+}
+
+int main() {
+  int sizes[N_SIZES]={10, 1000, 100000};
+  Array_set array;
+  Set *set = NULL;
+  int type;
+  clock_t start;
+  double t_add, t_has, t_del;
+  long rounds, r, found;
+  int s, n, i;
+
+  printf("%8s %6s %12s %12s %12s  (ns per operation)\n", "size", "set", "add", "has", "del");
+  for (s=0; s<N_SIZES; s++) {
+    n = sizes[s];
+    rounds = (MIN_OPS/n > 0) ? MIN_OPS/n : 1;
+
+    array.id = (Id*)malloc(n*sizeof(Id));
+    if (!array.id)
+      return EXIT_FAILURE;
+    t_add = t_has = t_del = 0;
+    found = 0;
+    /* The array is quadratic, so above 1k it is timed only once */
+    for (r=0; r<(n>1000 ? 1 : rounds); r++) {
+      array.num = 0;
+      start = clock();
+      for (i=0; i<n; i++) array_add(&array, 7L*i+1);
+      t_add += elapsed(start);
+      start = clock();
+      for (i=0; i<n; i++) found += array_has_id(&array, 7L*(n-1-i)+1);
+      t_has += elapsed(start);
+      start = clock();
+      for (i=0; i<n; i++) array_del(&array, 7L*i+1);
+      t_del += elapsed(start);
+    }
+    r = (n>1000 ? 1 : rounds)*(long)n;
+    printf("%8d %6s %12.1f %12.1f %12.1f\n", n, "array", 1e9*t_add/r, 1e9*t_has/r, 1e9*t_del/r);
+    free(array.id);
+
+    for (type=HASH_SET; type<=BIT_SET; type++) {
+      t_add = t_has = t_del = 0;
+      for (r=0; r<rounds; r++) {
+        set = set_create_type(NULL, type);
+        if (!set)
+          return EXIT_FAILURE;
+        start = clock();
+        for (i=0; i<n; i++) set_add(set, 7L*i+1);
+        t_add += elapsed(start);
+        start = clock();
+        for (i=0; i<n; i++) found += set_has_id(set, 7L*(n-1-i)+1);
+        t_has += elapsed(start);
+        start = clock();
+        for (i=0; i<n; i++) set_del(set, 7L*i+1);
+        t_del += elapsed(start);
+        set_destroy(set);
+      }
+      r = rounds*(long)n;
+      printf("%8d %6s %12.1f %12.1f %12.1f\n", n, type==HASH_SET ? "hash" : "bits", 1e9*t_add/r, 1e9*t_has/r, 1e9*t_del/r);
+    }
+    if (found == 0)
+      printf("Nothing found\n");
+  }
+
+  return EXIT_SUCCESS;
+}
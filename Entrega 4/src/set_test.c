@@ -18,6 +18,9 @@ int main(int argc, char *argv[]) {
   int i;
   Id id[NUM_ID]={0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 8, 9, 8, 9, 5};
   Set* set=NULL;
+  Arena* arena=NULL;
+  long size;
+  Id first;
   fprintf(stdout, "Creating the set:\n");
   set=set_create();
   if (set==NULL) {
@@ -44,8 +47,72 @@ int main(int argc, char *argv[]) {
     }
   }
   set_print(set);
+  fprintf(stdout, "Checking the order of the values left {0, 2, 4, 5, 6, 7, 8}\n");
+  for (i=0; i<set_get_num(set); i++) {
+    if (set_get(set, i)!=id[i<1 ? 0 : (i<2 ? 2 : i+2)]) {
+      fprintf(stdout, "Error, value %d is %ld.\n", i, set_get(set, i));
+      set_destroy(set);
+      return -1;
+    }
+  }
+  fprintf(stdout, "Introducing the values from 100 to 1099\n");
+  for (i=100; i<1100; i++) {
+    if (set_add(set, i)==ERROR || set_has_id(set, i)==FALSE) {
+      fprintf(stdout, "Error while introducing values.\n");
+      set_destroy(set);
+      return -1;
+    }
+  }
+  if (set_get_num(set)!=1007 || set_get(set, 1006)!=1099 || set_has_id(set, 3)==TRUE) {
+    fprintf(stdout, "Error, the set has %d values.\n", set_get_num(set));
+    set_destroy(set);
+    return -1;
+  }
+  fprintf(stdout, "Set grown succesfully to %d values.\n", set_get_num(set));
   fprintf(stdout, "Destroying the set\n");
   set_destroy(set);
 
+  fprintf(stdout, "Creating a bit set and introducing {200, 13, 70, 20, 13}\n");
+  set=set_create_type(NULL, BIT_SET);
+  if (set==NULL || set_add(set, 200)==ERROR || set_add(set, 13)==ERROR || set_add(set, 70)==ERROR ||
+      set_add(set, 20)==ERROR || set_add(set, 13)==ERROR || set_add(set, -5)==OK) {
+    fprintf(stdout, "Error while introducing values.\n");
+    set_destroy(set);
+    return -1;
+  }
+  set_print(set);
+  fprintf(stdout, "Extracting 70 and checking the order of the values left {13, 20, 200}\n");
+  if (set_del(set, 70)==ERROR || set_del(set, 70)==OK || set_get_num(set)!=3 || set_get(set, 0)!=13 ||
+      set_get(set, 1)!=20 || set_get(set, 2)!=200 || set_get(set, 3)!=NO_ID || set_has_id(set, 70)==TRUE) {
+    fprintf(stdout, "Error in the bit set.\n");
+    set_destroy(set);
+    return -1;
+  }
+  fprintf(stdout, "Bit set checked succesfully.\n");
+  set_destroy(set);
+
+  fprintf(stdout, "Creating a set in an arena, extracting and introducing the first value 1000 times\n");
+  arena=arena_create();
+  set=set_create_in(arena);
+  for (i=0; i<NUM_ID; i++)
+    set_add(set, id[i]);
+  size=arena_get_size(arena);
+  for (i=0; i<1000; i++) {
+    /* The first value leaves a hole, removed when the set is walked */
+    first=set_get(set, 0);
+    if (set_del(set, first)==ERROR || set_get(set, 0)==NO_ID || set_add(set, first)==ERROR) {
+      fprintf(stdout, "Error in the set in an arena.\n");
+      arena_destroy(arena);
+      return -1;
+    }
+  }
+  if (arena_get_size(arena)!=size || set_get_num(set)!=10) {
+    fprintf(stdout, "Error, the arena grew from %ld to %ld bytes.\n", size, arena_get_size(arena));
+    arena_destroy(arena);
+    return -1;
+  }
+  fprintf(stdout, "Set in an arena checked succesfully.\n");
+  arena_destroy(arena);
+
   return 0;
 }
@@ -0,0 +1,276 @@
+/**
+ * @brief Defines the optimiser of ANSI colour sequences (sgr)
+ *
+ * @file sgr.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sgr.h"
+
+#define SGR_COLOR_LEN 20   /*!< Longest colour parameters, as in 38;2;255;255;255 */
+#define SGR_MAX_LEN 128    /*!< Longest sequence written */
+
+/**
+ * @brief SGR state
+ *
+ * This structure defines the attributes a character is painted with.
+ */
+typedef struct {
+  int flags;                  /*!< Bit n set if the attribute n (1 to 9) is on */
+  char fg[SGR_COLOR_LEN];     /*!< Parameters of the foreground colour, empty for the default one */
+  char bg[SGR_COLOR_LEN];     /*!< Parameters of the background colour, empty for the default one */
+} Sgr_state;
+
+/**
+ * @brief Attribute n turned off by each code from 21 to 29, 0 if none
+ */
+static const int __off_codes[10] = {0, 22, 22, 23, 24, 25, 25, 27, 28, 29};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Sets a state to the default attributes.
+ * @param state pointer to the state.
+ */
+void sgr_utils_reset(Sgr_state* state);
+
+/**
+ * @brief Compares two states.
+ * @return TRUE if they paint the same, FALSE otherwise.
+ */
+BOOL sgr_utils_equal(const Sgr_state* a, const Sgr_state* b);
+
+/**
+ * @brief Applies the parameters of a SGR sequence to a state.
+ * @param state pointer to the state.
+ * @param params parameters of the sequence, between "\033[" and "m".
+ * @param len length of the parameters.
+ * @return OK if every parameter is known, ERROR otherwise.
+ */
+STATUS sgr_utils_apply(Sgr_state* state, const char* params, int len);
+
+/**
+ * @brief Writes the shortest sequence that goes from a state to another.
+ * @param from state on the terminal.
+ * @param to state wanted.
+ * @param seq where the sequence is written, SGR_MAX_LEN bytes at least.
+ * @return length of the sequence.
+ */
+int sgr_utils_transition(const Sgr_state* from, const Sgr_state* to, char* seq);
+
+/**
+ * @brief Appends a parameter to a list of parameters separated by ';'.
+ */
+void sgr_utils_param(char* params, const char* param);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
+int sgr_minimise(char* str) {
+  Sgr_state sent, wanted;
+  char seq[SGR_MAX_LEN];
+  char *out = NULL;
+  int i, j, k, len, out_len = 0;
+
+  if (!str)
+    return -1;
+
+  len = strlen(str);
+  out = (char *) malloc((len+1)*sizeof(char));
+  if (!out)
+    return -1;
+
+  sgr_utils_reset(&sent);
+  sgr_utils_reset(&wanted);
+
+  for (i=0; i<len; i=j) {
+    if (str[i] == '\033' && str[i+1] == '[') {
+      /* Parameters up to the final byte */
+      for (j=i+2; j<len && (str[j] < 0x40 || str[j] > 0x7E); j++);
+      if (j == len) {
+        free(out);
+        return len;
+      }
+      j++;
+      if (str[j-1] == 'm') {
+        if (sgr_utils_apply(&wanted, str+i+2, j-i-3) == ERROR) {
+          free(out);
+          return len;
+        }
+      }
+      else {
+        /* Other sequences do not change the attributes, they stay */
+        memcpy(out+out_len, str+i, j-i);
+        out_len += j-i;
+      }
+      continue;
+    }
+
+    /* A character: it is sent with the attributes wanted for it */
+    if (sgr_utils_equal(&sent, &wanted) == FALSE) {
+      k = sgr_utils_transition(&sent, &wanted, seq);
+      if (out_len + k > i) {
+        /* The line did it in less bytes, so it stays as it is */
+        free(out);
+        return len;
+      }
+      memcpy(out+out_len, seq, k);
+      out_len += k;
+      sent = wanted;
+    }
+    out[out_len++] = str[i];
+    j = i+1;
+  }
+
+  /* The line ends with the attributes it ended with */
+  if (sgr_utils_equal(&sent, &wanted) == FALSE) {
+    k = sgr_utils_transition(&sent, &wanted, seq);
+    if (out_len + k > len) {
+      free(out);
+      return len;
+    }
+    memcpy(out+out_len, seq, k);
+    out_len += k;
+  }
+
+  if (out_len < len) {
+    memcpy(str, out, out_len);
+    str[out_len] = '\0';
+    len = out_len;
+  }
+  free(out);
+
+  return len;
+}
+
+void sgr_utils_reset(Sgr_state* state) {
+  state->flags = 0;
+  state->fg[0] = '\0';
+  state->bg[0] = '\0';
+}
+
+BOOL sgr_utils_equal(const Sgr_state* a, const Sgr_state* b) {
+  if (a->flags != b->flags || strcmp(a->fg, b->fg) != 0 || strcmp(a->bg, b->bg) != 0)
+    return FALSE;
+  return TRUE;
+}
+
+STATUS sgr_utils_apply(Sgr_state* state, const char* params, int len) {
+  int p[SGR_MAX_LEN];
+  int i, n = 0, value = 0, digits = 0;
+  char *color = NULL;
+
+  /* Empty parameters stand for 0 */
+  for (i=0; i<=len; i++) {
+    if (i == len || params[i] == ';') {
+      if (n == SGR_MAX_LEN)
+        return ERROR;
+      p[n++] = value;
+      value = 0;
+      digits = 0;
+    }
+    else if (params[i] >= '0' && params[i] <= '9' && digits < 4) {
+      value = value*10 + params[i]-'0';
+      digits++;
+    }
+    else
+      return ERROR;
+  }
+
+  for (i=0; i<n; i++) {
+    if (p[i] == 0)
+      sgr_utils_reset(state);
+    else if (p[i] >= 1 && p[i] <= 9)
+      state->flags |= 1 << p[i];
+    else if (p[i] == 22)
+      state->flags &= ~((1 << 1) | (1 << 2));
+    else if (p[i] == 25)
+      state->flags &= ~((1 << 5) | (1 << 6));
+    else if (p[i] >= 23 && p[i] <= 29 && p[i] != 26)
+      state->flags &= ~(1 << (p[i]-20));
+    else if ((p[i] >= 30 && p[i] <= 37) || (p[i] >= 90 && p[i] <= 97))
+      sprintf(state->fg, "%d", p[i]);
+    else if (p[i] == 39)
+      state->fg[0] = '\0';
+    else if ((p[i] >= 40 && p[i] <= 47) || (p[i] >= 100 && p[i] <= 107))
+      sprintf(state->bg, "%d", p[i]);
+    else if (p[i] == 49)
+      state->bg[0] = '\0';
+    else if (p[i] == 38 || p[i] == 48) {
+      color = (p[i] == 38) ? state->fg : state->bg;
+      if (i+2 < n && p[i+1] == 5 && p[i+2] < 256) {
+        sprintf(color, "%d;5;%d", p[i], p[i+2]);
+        i += 2;
+      }
+      else if (i+4 < n && p[i+1] == 2 && p[i+2] < 256 && p[i+3] < 256 && p[i+4] < 256) {
+        sprintf(color, "%d;2;%d;%d;%d", p[i], p[i+2], p[i+3], p[i+4]);
+        i += 4;
+      }
+      else
+        return ERROR;
+    }
+    else
+      return ERROR;
+  }
+
+  return OK;
+}
+
+int sgr_utils_transition(const Sgr_state* from, const Sgr_state* to, char* seq) {
+  char step[SGR_MAX_LEN] = "", reset[SGR_MAX_LEN] = "0";
+  char code[SGR_COLOR_LEN];
+  int n, flags = from->flags;
+
+  /* One by one: attributes off, attributes on and colours */
+  for (n=1; n<=9; n++) {
+    if ((flags & (1 << n)) && !(to->flags & (1 << n))) {
+      sprintf(code, "%d", __off_codes[n]);
+      sgr_utils_param(step, code);
+      /* 22 and 25 turn off two attributes at once */
+      if (n == 1 || n == 2)
+        flags &= ~((1 << 1) | (1 << 2));
+      else if (n == 5 || n == 6)
+        flags &= ~((1 << 5) | (1 << 6));
+      else
+        flags &= ~(1 << n);
+    }
+  }
+  for (n=1; n<=9; n++) {
+    if (!(flags & (1 << n)) && (to->flags & (1 << n))) {
+      sprintf(code, "%d", n);
+      sgr_utils_param(step, code);
+    }
+  }
+  if (strcmp(from->fg, to->fg) != 0)
+    sgr_utils_param(step, to->fg[0] ? to->fg : "39");
+  if (strcmp(from->bg, to->bg) != 0)
+    sgr_utils_param(step, to->bg[0] ? to->bg : "49");
+
+  /* Reset: every attribute of the new state */
+  for (n=1; n<=9; n++) {
+    if (to->flags & (1 << n)) {
+      sprintf(code, "%d", n);
+      sgr_utils_param(reset, code);
+    }
+  }
+  if (to->fg[0])
+    sgr_utils_param(reset, to->fg);
+  if (to->bg[0])
+    sgr_utils_param(reset, to->bg);
+
+  return sprintf(seq, "\033[%sm", strlen(step) <= strlen(reset) ? step : reset);
+}
+
+void sgr_utils_param(char* params, const char* param) {
+  if (params[0] != '\0')
+    strcat(params, ";");
+  strcat(params, param);
+}
@@ -0,0 +1,101 @@
+/**
+ * @brief It tests sgr module
+ *
+ * @file sgr_test.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sgr_test.h"
+#define MAX_TESTS 8
+
+/**
+ * @brief Main function to test sgr module.
+ *
+ * Two execution options:
+ *   1.-If no parameters, all test will run
+ *   2.-If you run with a number between 1 and the number of tests just run
+ *      the indicated test
+ *
+ */
+int main(int argc, char** argv) {
+
+    int test = 0;
+    int all = 1;
+
+    if (argc < 2) {
+        printf("Running all test for module sgr:\n");
+    } else {
+        test = atoi(argv[1]);
+        all = 0;
+        printf("Running test %d:\t", test);
+	if (test < 1 || test > MAX_TESTS) {
+	  printf("Error: unknown test %d\t", test);
+	  exit(EXIT_SUCCESS);
+        }
+    }
+
+
+    if (all || test == 1) test1_sgr_minimise();
+    if (all || test == 2) test2_sgr_minimise();
+    if (all || test == 3) test3_sgr_minimise();
+    if (all || test == 4) test4_sgr_minimise();
+    if (all || test == 5) test5_sgr_minimise();
+    if (all || test == 6) test6_sgr_minimise();
+    if (all || test == 7) test7_sgr_minimise();
+    if (all || test == 8) test8_sgr_minimise();
+
+
+    PRINT_PASSED_PERCENTAGE;
+
+    return EXIT_SUCCESS;
+}
+
+void test1_sgr_minimise() {
+    char str[64] = "\033[0;31;41mab\033[0;31;41mc";
+    PRINT_TEST_RESULT(sgr_minimise(str) == 11 && strcmp(str, "\033[31;41mabc") == 0);
+}
+
+void test2_sgr_minimise() {
+    char str[64] = "\033[0;31;41ma\033[0;32;41mb";
+    sgr_minimise(str);
+    PRINT_TEST_RESULT(strcmp(str, "\033[31;41ma\033[32mb") == 0);
+}
+
+void test3_sgr_minimise() {
+    char str[64] = "\033[0;1;31ma\033[0;31mb";
+    sgr_minimise(str);
+    PRINT_TEST_RESULT(strcmp(str, "\033[1;31ma\033[22mb") == 0);
+}
+
+void test4_sgr_minimise() {
+    char str[64] = "\033[0;1;5;31;41ma\033[0mb";
+    sgr_minimise(str);
+    PRINT_TEST_RESULT(strcmp(str, "\033[1;5;31;41ma\033[0mb") == 0);
+}
+
+void test5_sgr_minimise() {
+    char str[64] = "\033[0;36;5;40;100ma\033[0m";
+    sgr_minimise(str);
+    PRINT_TEST_RESULT(strcmp(str, "\033[5;36;100ma\033[0m") == 0);
+}
+
+void test6_sgr_minimise() {
+    char str[64] = "\033[38;5;200ma\033[0;38;5;200mb";
+    sgr_minimise(str);
+    PRINT_TEST_RESULT(strcmp(str, "\033[38;5;200mab") == 0);
+}
+
+void test7_sgr_minimise() {
+    char str[64] = "\033[0;53ma\033[0mb";
+    PRINT_TEST_RESULT(sgr_minimise(str) == 13 && strcmp(str, "\033[0;53ma\033[0mb") == 0);
+}
+
+void test8_sgr_minimise() {
+    PRINT_TEST_RESULT(sgr_minimise(NULL) == -1);
+}
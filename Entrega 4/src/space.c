@@ -12,6 +12,7 @@
 #include <string.h>
 #include "types.h"
 #include "space.h"
+#include "intern.h"
 
 /**
  * @brief Space
@@ -20,35 +21,70 @@
  */
 struct _Space {
   Id id;                          /*!< Space identifier */
-  char name[WORD_SIZE + 1];       /*!< Space name */
+  int name;                       /*!< Handle of the space name */
   Id north;                       /*!< Identifier of the link to the space in the north */
   Id south;                       /*!< Identifier of the link to the space in the south*/
   Id east;                        /*!< Identifier of the link to the space in the east */
   Id west;                        /*!< Identifier of the link to the space in the west */
   Id up;                          /*!< Identifier of the link to the space above */
   Id down;                        /*!< Identifier of the link to the space below */
-  char description[WORD_SIZE +1]; /*!< Space description */
-  char full_description[WORD_SIZE +1]; /*!< Space description showed in inspect command */
+  int description;                /*!< Handle of the space description */
+  int full_description;           /*!< Handle of the space description showed in inspect command */
   Set* object;                    /*!< Set of objects identifiers */
-  char gdesc[MAX_GDESC_LINES][MAX_GDESC_LENGTH]; /*!< Space graphic description */
+  int gdesc[MAX_GDESC_LINES];     /*!< Handles of the lines of the space graphic description */
+  Intern* strings;                /*!< Table of the strings of the space */
+  BOOL own_strings;               /*!< TRUE if the table belongs to the space */
+  Arena* arena;                   /*!< Arena of the space, NULL if it comes from malloc() */
   BOOL lighting;
 };
 
+/**
+ * @brief Changes every time the link of a space in any direction is set, so what
+ * was built from the links of the spaces can tell it is old
+ */
+static long space_links_version = 0;
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Stores a string of the space.
+ * @param space pointer to the space.
+ * @param str string.
+ * @param handle where the handle of the string is written.
+ * @return OK if the process is completed succesfully, ERROR otherwise.
+ */
+STATUS space_utils_put(Space* space, const char* str, int* handle);
+
+/**
+ * @brief Gets a string of the space.
+ * @param space pointer to the space.
+ * @param handle handle of the string.
+ * @return the string.
+ */
+const char* space_utils_get(Space* space, int handle);
+
 Space* space_create(Id id) {
+  return space_create_in(NULL, id);
+}
+
+Space* space_create_in(Arena* arena, Id id) {
   int gdescline;
   Space *space = NULL;
 
   if (id == NO_ID)
     return NULL;
 
-  space = (Space *) malloc(sizeof (Space));
+  space = (Space *) arena_alloc(arena, sizeof (Space));
 
   if (space == NULL) {
     return NULL;
   }
   space->id = id;
+  space->arena = arena;
 
-  space->name[0] = '\0';
+  space->name = NO_STRING;
 
   space->north = NO_ID;
   space->south = NO_ID;
@@ -56,11 +92,14 @@ Space* space_create(Id id) {
   space->west = NO_ID;
   space->up = NO_ID;
   space->down = NO_ID;
-  space->description[0]='\0';
-  space->object=set_create();
+  space->description = NO_STRING;
+  space->full_description = NO_STRING;
+  space->object=set_create_type(arena, BIT_SET);
   for (gdescline=0; gdescline<MAX_GDESC_LINES; gdescline++) {
-    space->gdesc[gdescline][0]='\0';
+    space->gdesc[gdescline]=NO_STRING;
   }
+  space->strings = NULL;
+  space->own_strings = FALSE;
   space->lighting = FALSE;
 
   return space;
@@ -71,8 +110,10 @@ STATUS space_destroy(Space* space) {
     return ERROR;
   }
   set_destroy(space->object);
+  if (space->own_strings == TRUE)
+    intern_destroy(space->strings);
 
-  free(space);
+  arena_free(space->arena, space);
   space = NULL;
 
   return OK;
@@ -83,7 +124,7 @@ STATUS space_set_name(Space* space, char* name) {
     return ERROR;
   }
 
-  if (!strcpy(space->name, name)) {
+  if (space_utils_put(space, name, &space->name) == ERROR) {
     return ERROR;
   }
 
@@ -95,7 +136,7 @@ STATUS space_set_description(Space* space, char* description) {
     return ERROR;
   }
 
-  if (!strcpy(space->description, description)) {
+  if (space_utils_put(space, description, &space->description) == ERROR) {
     return ERROR;
   }
 
@@ -107,7 +148,7 @@ STATUS space_set_full_description(Space* space, char* full_description) {
     return ERROR;
   }
 
-  if (!strcpy(space->full_description, full_description)) {
+  if (space_utils_put(space, full_description, &space->full_description) == ERROR) {
     return ERROR;
   }
 
@@ -119,6 +160,7 @@ STATUS space_set_north(Space* space, Id id) {
     return ERROR;
   }
   space->north = id;
+  space_links_version++;
   return OK;
 }
 
@@ -127,6 +169,7 @@ STATUS space_set_south(Space* space, Id id) {
     return ERROR;
   }
   space->south = id;
+  space_links_version++;
   return OK;
 }
 
@@ -135,6 +178,7 @@ STATUS space_set_east(Space* space, Id id) {
     return ERROR;
   }
   space->east = id;
+  space_links_version++;
   return OK;
 }
 
@@ -143,6 +187,7 @@ STATUS space_set_west(Space* space, Id id) {
     return ERROR;
   }
   space->west = id;
+  space_links_version++;
   return OK;
 }
 
@@ -151,6 +196,7 @@ STATUS space_set_up(Space* space, Id id) {
     return ERROR;
   }
   space->up = id;
+  space_links_version++;
   return OK;
 }
 
@@ -159,9 +205,14 @@ STATUS space_set_down(Space* space, Id id) {
     return ERROR;
   }
   space->down = id;
+  space_links_version++;
   return OK;
 }
 
+long space_get_links_version() {
+  return space_links_version;
+}
+
 STATUS space_set_object(Space* space, Id id) {
   if(!space || id == NO_ID){
     return ERROR;
@@ -173,21 +224,21 @@ const char * space_get_name(Space* space) {
   if (!space) {
     return NULL;
   }
-  return space->name;
+  return space_utils_get(space, space->name);
 }
 
 const char * space_get_description(Space* space) {
   if (!space) {
     return NULL;
   }
-  return space->description;
+  return space_utils_get(space, space->description);
 }
 
 const char * space_get_full_description(Space* space) {
-  if (!space || space->lighting == FALSE) {
+  if (!space) {
     return NULL;
   }
-  return space->full_description;
+  return space_utils_get(space, space->full_description);
 }
 
 Id space_get_id(Space* space) {
@@ -255,6 +306,12 @@ STATUS space_del_object(Space* space, Id id) {
   return OK;
 }
 
+BOOL space_has_object(Space* space, Id id) {
+  if (!space)
+    return FALSE;
+  return set_has_id(space->object, id);
+}
+
 int space_get_number_of_objects(Space* space) {
   if (!space)
     return -1;
@@ -262,21 +319,63 @@ int space_get_number_of_objects(Space* space) {
 }
 
 const char* space_get_gdesc(Space* space, int line) {
-  if(!space){
+  if(!space || line<1 || line>MAX_GDESC_LINES){
     return NULL;
   }
-  return space->gdesc[line-1];
+  return space_utils_get(space, space->gdesc[line-1]);
 }
 
 STATUS space_set_gdesc(Space* space, char* gdesc, int line) {
   if(!space || line<1 || line>MAX_GDESC_LINES || gdesc==NULL) {
     return ERROR;
   }
-  strcpy(space->gdesc[line-1], gdesc);
+  return space_utils_put(space, gdesc, &space->gdesc[line-1]);
+}
+
+STATUS space_set_intern(Space* space, Intern* strings) {
+  int i;
+
+  if (!space || !strings)
+    return ERROR;
+  if (space->strings == strings)
+    return OK;
+
+  if (space->strings) {
+    space->name = intern_put(strings, intern_get(space->strings, space->name));
+    space->description = intern_put(strings, intern_get(space->strings, space->description));
+    space->full_description = intern_put(strings, intern_get(space->strings, space->full_description));
+    for (i=0; i<MAX_GDESC_LINES; i++) {
+      space->gdesc[i] = intern_put(strings, intern_get(space->strings, space->gdesc[i]));
+    }
+    if (space->own_strings == TRUE)
+      intern_destroy(space->strings);
+  }
+  space->strings = strings;
+  space->own_strings = FALSE;
 
   return OK;
 }
 
+STATUS space_utils_put(Space* space, const char* str, int* handle) {
+  if (!space->strings) {
+    /* Until the space is added to a game it keeps its strings in a table of its own */
+    if ((space->strings = intern_create(NULL)) == NULL)
+      return ERROR;
+    space->own_strings = TRUE;
+  }
+  *handle = intern_put(space->strings, str);
+  if (*handle == NO_STRING && str[0] != '\0')
+    return ERROR;
+
+  return OK;
+}
+
+const char* space_utils_get(Space* space, int handle) {
+  if (!space->strings)
+    return "";
+  return intern_get(space->strings, handle);
+}
+
 BOOL space_get_lighting(Space *space) {
   if(!space) {
     return FALSE;
@@ -302,7 +401,7 @@ STATUS space_print(Space* space) {
     return ERROR;
   }
 
-  fprintf(stdout, "--> Space (Id: %ld; Name: %s)\n", space->id, space->name);
+  fprintf(stdout, "--> Space (Id: %ld; Name: %s)\n", space->id, space_get_name(space));
 
   idaux = space_get_north(space);
   if (NO_ID != idaux) {
@@ -360,10 +459,10 @@ STATUS space_print(Space* space) {
     if(!space_get_gdesc(space, i)) {
       break;
     }
-    fprintf(stdout, "       %s\n", space->gdesc[i]);
+    fprintf(stdout, "       %s\n", space_get_gdesc(space, i));
   }
 
-  fprintf(stdout, "       %s\n", space->description);
+  fprintf(stdout, "       %s\n", space_get_description(space));
 
   fprintf(stdout, "---> Space illuminated?: ");
   if(space->lighting == TRUE){
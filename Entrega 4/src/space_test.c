@@ -16,7 +16,7 @@
 #include "space_test.h"
 
 
-#define MAX_TESTS 40
+#define MAX_TESTS 42
 
 /**
  * @brief Main function to test space module.
@@ -85,6 +85,8 @@ int main(int argc, char** argv) {
     if (all || test == 38) test2_space_get_gdesc();
     if (all || test == 39) test1_space_set_gdesc();
     if (all || test == 40) test2_space_set_gdesc();
+    if (all || test == 41) test1_space_set_intern();
+    if (all || test == 42) test2_space_set_intern();
 
     PRINT_PASSED_PERCENTAGE;
 
@@ -330,3 +332,21 @@ void test2_space_set_gdesc(){
   Space *s=NULL;
   PRINT_TEST_RESULT(space_set_gdesc(s,"Test",1) == ERROR);
 }
+
+void test1_space_set_intern(){
+  Space *s;
+  Intern *a;
+  s=space_create(24);
+  a=intern_create(NULL);
+  space_set_gdesc(s,"Test",2);
+  space_set_name(s,"Sala");
+  PRINT_TEST_RESULT(space_set_intern(s,a) == OK && strcmp(space_get_gdesc(s,2),"Test") == 0 && strcmp(space_get_name(s),"Sala") == 0 && intern_get_number_of_strings(a) == 2);
+  space_destroy(s);
+  intern_destroy(a);
+}
+void test2_space_set_intern(){
+  Space *s;
+  s=space_create(24);
+  PRINT_TEST_RESULT(space_set_intern(s,NULL) == ERROR);
+  space_destroy(s);
+}
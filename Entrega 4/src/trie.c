@@ -0,0 +1,276 @@
+/**
+ * @brief Defines a prefix tree of words (trie)
+ *
+ * @file trie.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include "trie.h"
+
+#define TRIE_INIT_NODES 64   /*!< Nodes room is made for at first */
+#define NO_NODE -1           /*!< Missing child or sibling */
+
+/**
+ * @brief Node of the tree
+ *
+ * Every node is a character of the words going through it. Its children are a
+ * list of siblings sorted by their character.
+ */
+typedef struct {
+  char c;              /*!< Character of the node */
+  int child;           /*!< First child, NO_NODE if none */
+  int sibling;         /*!< Next sibling, NO_NODE if none */
+  int value;           /*!< Value of the word ending here, NO_MATCH if none */
+  const char *word;    /*!< Word ending here, NULL if none */
+  int n_words;         /*!< Words ending here or below */
+  int first;           /*!< Node of the first word added here or below, NO_NODE if none */
+} Trie_node;
+
+/**
+ * @brief Prefix tree
+ *
+ * This structure defines a tree of words whose nodes are kept in an array, the
+ * first one being the root, the empty word.
+ */
+struct _Trie {
+  Trie_node *node;     /*!< Nodes of the tree */
+  int n_nodes;         /*!< Number of nodes */
+  int max_nodes;       /*!< Room for nodes before growing */
+  BOOL ignore_case;    /*!< TRUE if the case of the words does not matter */
+};
+
+/****************************/
+/*     Private functions    */
+/****************************/
+
+/**
+ * @brief Gets a character the way the tree compares it.
+ * @param trie pointer to the tree.
+ * @param c character.
+ * @return the character, in lower case if the tree ignores it.
+ */
+char trie_utils_fold(Trie* trie, char c);
+
+/**
+ * @brief Gets the child of a node with a character.
+ * @param trie pointer to the tree.
+ * @param n node.
+ * @param c character, already folded.
+ * @param add TRUE to add the child if it is missing.
+ * @return the child, NO_NODE if it is missing or ERROR.
+ */
+int trie_utils_child(Trie* trie, int n, char c, BOOL add);
+
+/**
+ * @brief Gets the node a word ends at.
+ * @param trie pointer to the tree.
+ * @param word word.
+ * @return the node, NO_NODE if no word goes through it.
+ */
+int trie_utils_walk(Trie* trie, const char* word);
+
+/**
+ * @brief Writes the words ending at a node or below, in alphabetical order.
+ * @param trie pointer to the tree.
+ * @param n node.
+ * @param words where the words are written.
+ * @param max room in words.
+ * @param found number of words written so far, updated.
+ */
+void trie_utils_collect(Trie* trie, int n, const char** words, int max, int* found);
+
+/****************************/
+/* Functions implementation */
+/****************************/
+
+Trie* trie_create(BOOL ignore_case) {
+  Trie *trie = NULL;
+
+  trie = (Trie *) malloc(sizeof(Trie));
+  if (!trie)
+    return NULL;
+
+  trie->node = (Trie_node *) malloc(TRIE_INIT_NODES*sizeof(Trie_node));
+  if (!trie->node) {
+    free(trie);
+    return NULL;
+  }
+  trie->max_nodes = TRIE_INIT_NODES;
+  trie->ignore_case = ignore_case;
+  trie_clear(trie);
+
+  return trie;
+}
+
+void trie_destroy(Trie* trie) {
+  if (!trie)
+    return;
+
+  free(trie->node);
+  free(trie);
+}
+
+STATUS trie_clear(Trie* trie) {
+  if (!trie)
+    return ERROR;
+
+  trie->node[0].c = '\0';
+  trie->node[0].child = NO_NODE;
+  trie->node[0].sibling = NO_NODE;
+  trie->node[0].value = NO_MATCH;
+  trie->node[0].word = NULL;
+  trie->node[0].n_words = 0;
+  trie->node[0].first = NO_NODE;
+  trie->n_nodes = 1;
+
+  return OK;
+}
+
+STATUS trie_add(Trie* trie, const char* word, int value) {
+  const char *w;
+  int n = 0, end;
+
+  if (!trie || !word || value < 0)
+    return ERROR;
+
+  for (w = word; *w; w++) {
+    n = trie_utils_child(trie, n, trie_utils_fold(trie, *w), TRUE);
+    if (n == NO_NODE)
+      return ERROR;
+  }
+  if (trie->node[n].value != NO_MATCH)
+    return OK;
+
+  end = n;
+  trie->node[end].value = value;
+  trie->node[end].word = word;
+
+  /* Every node on the way counts the new word */
+  for (n = 0, w = word; ; w++) {
+    trie->node[n].n_words++;
+    if (trie->node[n].first == NO_NODE)
+      trie->node[n].first = end;
+    if (!*w)
+      break;
+    n = trie_utils_child(trie, n, trie_utils_fold(trie, *w), FALSE);
+  }
+
+  return OK;
+}
+
+int trie_find(Trie* trie, const char* word) {
+  int n;
+
+  if (!trie || !word)
+    return NO_MATCH;
+
+  n = trie_utils_walk(trie, word);
+  if (n == NO_NODE)
+    return NO_MATCH;
+  return trie->node[n].value;
+}
+
+int trie_find_prefix(Trie* trie, const char* prefix) {
+  int n;
+
+  if (!trie || !prefix)
+    return NO_MATCH;
+
+  n = trie_utils_walk(trie, prefix);
+  if (n == NO_NODE)
+    return NO_MATCH;
+  if (trie->node[n].value != NO_MATCH)
+    return trie->node[n].value;
+  if (trie->node[n].n_words != 1)
+    return NO_MATCH;
+
+  return trie->node[trie->node[n].first].value;
+}
+
+int trie_complete(Trie* trie, const char* prefix, const char** words, int max) {
+  int n, found = 0;
+
+  if (!trie || !prefix || max < 0 || (max > 0 && !words))
+    return -1;
+
+  n = trie_utils_walk(trie, prefix);
+  if (n == NO_NODE)
+    return 0;
+
+  trie_utils_collect(trie, n, words, max, &found);
+  return trie->node[n].n_words;
+}
+
+int trie_get_number_of_words(Trie* trie) {
+  if (!trie)
+    return -1;
+  return trie->node[0].n_words;
+}
+
+char trie_utils_fold(Trie* trie, char c) {
+  if (trie->ignore_case == TRUE)
+    return (char) tolower((unsigned char) c);
+  return c;
+}
+
+int trie_utils_child(Trie* trie, int n, char c, BOOL add) {
+  Trie_node *node = NULL;
+  int prev = NO_NODE, next;
+
+  /* The children are sorted, so the search stops at the first greater one */
+  for (next = trie->node[n].child; next != NO_NODE && trie->node[next].c < c; next = trie->node[next].sibling)
+    prev = next;
+  if (next != NO_NODE && trie->node[next].c == c)
+    return next;
+  if (add == FALSE)
+    return NO_NODE;
+
+  if (trie->n_nodes == trie->max_nodes) {
+    node = (Trie_node *) realloc(trie->node, 2*trie->max_nodes*sizeof(Trie_node));
+    if (!node)
+      return NO_NODE;
+    trie->node = node;
+    trie->max_nodes *= 2;
+  }
+
+  node = &trie->node[trie->n_nodes];
+  node->c = c;
+  node->child = NO_NODE;
+  node->sibling = next;
+  node->value = NO_MATCH;
+  node->word = NULL;
+  node->n_words = 0;
+  node->first = NO_NODE;
+  if (prev == NO_NODE)
+    trie->node[n].child = trie->n_nodes;
+  else
+    trie->node[prev].sibling = trie->n_nodes;
+
+  return trie->n_nodes++;
+}
+
+int trie_utils_walk(Trie* trie, const char* word) {
+  int n = 0;
+
+  for (; *word && n != NO_NODE; word++)
+    n = trie_utils_child(trie, n, trie_utils_fold(trie, *word), FALSE);
+
+  return n;
+}
+
+void trie_utils_collect(Trie* trie, int n, const char** words, int max, int* found) {
+  int child;
+
+  if (*found >= max)
+    return;
+  if (trie->node[n].word)
+    words[(*found)++] = trie->node[n].word;
+
+  for (child = trie->node[n].child; child != NO_NODE && *found < max; child = trie->node[child].sibling)
+    trie_utils_collect(trie, child, words, max, found);
+}
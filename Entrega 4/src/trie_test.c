@@ -0,0 +1,169 @@
+/**
+ * @brief It tests trie module
+ *
+ * @file trie_test.c
+ * @author Group 1
+ * @version 1.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trie_test.h"
+#define MAX_TESTS 12
+
+/**
+ * @brief Main function to test trie module.
+ *
+ * Two execution options:
+ *   1.-If no parameters, all test will run
+ *   2.-If you run with a number between 1 and the number of tests just run
+ *      the indicated test
+ *
+ */
+int main(int argc, char** argv) {
+
+    int test = 0;
+    int all = 1;
+
+    if (argc < 2) {
+        printf("Running all test for module trie:\n");
+    } else {
+        test = atoi(argv[1]);
+        all = 0;
+        printf("Running test %d:\t", test);
+	if (test < 1 || test > MAX_TESTS) {
+	  printf("Error: unknown test %d\t", test);
+	  exit(EXIT_SUCCESS);
+        }
+    }
+
+
+    if (all || test == 1) test1_trie_create();
+    if (all || test == 2) test1_trie_add();
+    if (all || test == 3) test2_trie_add();
+    if (all || test == 4) test3_trie_add();
+    if (all || test == 5) test1_trie_find();
+    if (all || test == 6) test2_trie_find();
+    if (all || test == 7) test1_trie_find_prefix();
+    if (all || test == 8) test2_trie_find_prefix();
+    if (all || test == 9) test1_trie_complete();
+    if (all || test == 10) test2_trie_complete();
+    if (all || test == 11) test1_trie_clear();
+    if (all || test == 12) test1_trie_get_number_of_words();
+
+
+    PRINT_PASSED_PERCENTAGE;
+
+    return EXIT_SUCCESS;
+}
+
+void test1_trie_create() {
+    Trie *trie = trie_create(FALSE);
+    PRINT_TEST_RESULT(trie != NULL && trie_find(trie, "take") == NO_MATCH);
+    trie_destroy(trie);
+}
+
+void test1_trie_add() {
+    Trie *trie = trie_create(FALSE);
+    PRINT_TEST_RESULT(trie_add(trie, "take", 1) == OK);
+    trie_destroy(trie);
+}
+
+void test2_trie_add() {
+    Trie *trie = trie_create(FALSE);
+    PRINT_TEST_RESULT(trie_add(NULL, "take", 1) == ERROR && trie_add(trie, NULL, 1) == ERROR && trie_add(trie, "take", NO_MATCH) == ERROR);
+    trie_destroy(trie);
+}
+
+void test3_trie_add() {
+    Trie *trie = trie_create(FALSE);
+    /* The first value of a word keeps it */
+    trie_add(trie, "take", 1);
+    trie_add(trie, "take", 2);
+    PRINT_TEST_RESULT(trie_find(trie, "take") == 1 && trie_get_number_of_words(trie) == 1);
+    trie_destroy(trie);
+}
+
+void test1_trie_find() {
+    Trie *trie = trie_create(FALSE);
+    char word[300][8];
+    int i, found = 1;
+    /* Enough words to make the nodes grow several times */
+    for (i=0; i<300; i++) {
+        sprintf(word[i], "w%d", i);
+        trie_add(trie, word[i], i);
+    }
+    for (i=0; i<300; i++) {
+        if (trie_find(trie, word[i]) != i)
+            found = 0;
+    }
+    PRINT_TEST_RESULT(found && trie_find(trie, "w") == NO_MATCH && trie_find(trie, "w300") == NO_MATCH);
+    trie_destroy(trie);
+}
+
+void test2_trie_find() {
+    Trie *trie = trie_create(TRUE);
+    trie_add(trie, "Lantern", 1);
+    PRINT_TEST_RESULT(trie_find(trie, "lantern") == 1 && trie_find(trie, "LANTERN") == 1 && trie_find(trie, "lanterns") == NO_MATCH);
+    trie_destroy(trie);
+}
+
+void test1_trie_find_prefix() {
+    Trie *trie = trie_create(FALSE);
+    trie_add(trie, "lantern", 1);
+    trie_add(trie, "lamp", 2);
+    trie_add(trie, "key", 3);
+    PRINT_TEST_RESULT(trie_find_prefix(trie, "lan") == 1 && trie_find_prefix(trie, "k") == 3 &&
+                      trie_find_prefix(trie, "la") == NO_MATCH && trie_find_prefix(trie, "door") == NO_MATCH);
+    trie_destroy(trie);
+}
+
+void test2_trie_find_prefix() {
+    Trie *trie = trie_create(FALSE);
+    /* A whole word wins over the longer ones it begins */
+    trie_add(trie, "turn", 1);
+    trie_add(trie, "turnon", 2);
+    trie_add(trie, "turnoff", 3);
+    PRINT_TEST_RESULT(trie_find_prefix(trie, "turn") == 1 && trie_find_prefix(trie, "turno") == NO_MATCH && trie_find_prefix(trie, "turnof") == 3);
+    trie_destroy(trie);
+}
+
+void test1_trie_complete() {
+    Trie *trie = trie_create(FALSE);
+    const char *words[3];
+    trie_add(trie, "lantern", 1);
+    trie_add(trie, "ladder", 2);
+    trie_add(trie, "lamp", 3);
+    trie_add(trie, "key", 4);
+    PRINT_TEST_RESULT(trie_complete(trie, "la", words, 3) == 3 && !strcmp(words[0], "ladder") && !strcmp(words[1], "lamp") && !strcmp(words[2], "lantern"));
+    trie_destroy(trie);
+}
+
+void test2_trie_complete() {
+    Trie *trie = trie_create(FALSE);
+    const char *words[1];
+    trie_add(trie, "lantern", 1);
+    trie_add(trie, "lamp", 2);
+    /* Only the room given is written, but every word is counted */
+    PRINT_TEST_RESULT(trie_complete(trie, "la", words, 1) == 2 && !strcmp(words[0], "lamp") &&
+                      trie_complete(trie, "x", words, 1) == 0 && trie_complete(NULL, "la", words, 1) == -1);
+    trie_destroy(trie);
+}
+
+void test1_trie_clear() {
+    Trie *trie = trie_create(FALSE);
+    trie_add(trie, "take", 1);
+    PRINT_TEST_RESULT(trie_clear(trie) == OK && trie_find(trie, "take") == NO_MATCH && trie_get_number_of_words(trie) == 0);
+    trie_destroy(trie);
+}
+
+void test1_trie_get_number_of_words() {
+    Trie *trie = trie_create(FALSE);
+    trie_add(trie, "take", 1);
+    trie_add(trie, "t", 2);
+    PRINT_TEST_RESULT(trie_get_number_of_words(trie) == 2 && trie_get_number_of_words(NULL) == -1);
+    trie_destroy(trie);
+}